@@ -0,0 +1,50 @@
+/**
+ * @file BenchUtil.hpp
+ * @brief extras/bench 下基准程序共用的计时工具
+ *
+ * 基准程序不依赖第三方框架，每个 .cpp 单独编译运行：
+ * @code
+ * g++ -std=c++20 -O2 -Isrc extras/bench/CRCBench.cpp -o crc_bench && ./crc_bench
+ * @endcode
+ */
+
+#ifndef RPL_EXTRAS_BENCH_UTIL_HPP
+#define RPL_EXTRAS_BENCH_UTIL_HPP
+
+#include <chrono>
+#include <cstddef>
+
+namespace Bench {
+
+/// @brief 阻止编译器把结果当作无用值消除
+template <typename T> inline void do_not_optimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief 重复执行 fn 并返回单次耗时的最小值（纳秒）
+ *
+ * 每轮执行 iterations 次，共 rounds 轮，取最快一轮的平均值，
+ * 以减少调度与频率波动的影响。
+ */
+template <typename Fn>
+double measure_ns(size_t iterations, Fn &&fn, int rounds = 5) {
+  using Clock = std::chrono::steady_clock;
+  double best = 0.0;
+  for (int r = 0; r < rounds; ++r) {
+    const auto start = Clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+      fn();
+    const double ns =
+        std::chrono::duration<double, std::nano>(Clock::now() - start)
+            .count() /
+        static_cast<double>(iterations);
+    if (r == 0 || ns < best)
+      best = ns;
+  }
+  return best;
+}
+
+} // namespace Bench
+
+#endif // RPL_EXTRAS_BENCH_UTIL_HPP
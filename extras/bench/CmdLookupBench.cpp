@@ -0,0 +1,98 @@
+/**
+ * @file CmdLookupBench.cpp
+ * @brief 命令码查找：两级稠密表与 frozen 完美哈希表的对比基准
+ *
+ * 使用 12 种裁判系统数据包（含未注册的命令码），分两部分测量：
+ * - 直接查找：denseLUT.find() 与 cmdToSeqIndex.find()，同一次运行中对比
+ * - Deserializer::write() 每帧耗时：经 cmd_entry()，取决于编译时的选择。
+ *   分别以默认选项与 -DRPL_USE_FROZEN_CMD_MAP 编译两次即可复现对比
+ *
+ * @par 构建与运行（仓库根目录）
+ * @code
+ * g++ -std=c++20 -O2 -Isrc extras/bench/CmdLookupBench.cpp -o lut_bench
+ * g++ -std=c++20 -O2 -Isrc -DRPL_USE_FROZEN_CMD_MAP \
+ *     extras/bench/CmdLookupBench.cpp -o frozen_bench
+ * ./lut_bench && ./frozen_bench
+ * @endcode
+ */
+
+#include "BenchUtil.hpp"
+#include <RPL/Deserializer.hpp>
+#include <RPL/Packets/RoboMaster/Buff.hpp>
+#include <RPL/Packets/RoboMaster/GameResult.hpp>
+#include <RPL/Packets/RoboMaster/GameRobotHP.hpp>
+#include <RPL/Packets/RoboMaster/GameStatus.hpp>
+#include <RPL/Packets/RoboMaster/HurtData.hpp>
+#include <RPL/Packets/RoboMaster/MapCommand.hpp>
+#include <RPL/Packets/RoboMaster/PowerHeatData.hpp>
+#include <RPL/Packets/RoboMaster/RemoteControl.hpp>
+#include <RPL/Packets/RoboMaster/RobotInteractionData.hpp>
+#include <RPL/Packets/RoboMaster/RobotPos.hpp>
+#include <RPL/Packets/RoboMaster/RobotStatus.hpp>
+#include <RPL/Packets/RoboMaster/ShootData.hpp>
+
+#include <array>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Des = RPL::Deserializer<GameStatus, GameResult, GameRobotHP, RobotStatus,
+                              PowerHeatData, RobotPos, Buff, HurtData,
+                              ShootData, RobotInteractionData, MapCommand,
+                              RemoteControl>;
+using Collector = RPL::Meta::PacketInfoCollector<
+    GameStatus, GameResult, GameRobotHP, RobotStatus, PowerHeatData, RobotPos,
+    Buff, HurtData, ShootData, RobotInteractionData, MapCommand,
+    RemoteControl>;
+
+/// @brief 已注册的命令码与两个未注册的命令码
+constexpr std::array<uint16_t, 14> cmds = {
+    0x0001, 0x0002, 0x0003, 0x0201, 0x0202, 0x0203, 0x0204,
+    0x0206, 0x0207, 0x0301, 0x0303, 0x0304, 0x0105, 0x0999};
+
+} // namespace
+
+int main() {
+  std::mt19937 rng(1);
+  std::vector<uint16_t> stream(1 << 16);
+  for (auto &c : stream)
+    c = cmds[rng() % cmds.size()];
+
+  // --- 直接查找 ---
+  const double dense = Bench::measure_ns(1, [&] {
+    for (const uint16_t c : stream)
+      Bench::do_not_optimize(Collector::denseLUT.find(c));
+  }) / static_cast<double>(stream.size());
+  const double frozen = Bench::measure_ns(1, [&] {
+    for (const uint16_t c : stream) {
+      const auto it = Collector::cmdToSeqIndex.find(c);
+      Bench::do_not_optimize(it != Collector::cmdToSeqIndex.end() ? it->second
+                                                                  : 0);
+    }
+  }) / static_cast<double>(stream.size());
+  std::printf("lookup: dense LUT %.2f ns, frozen map %.2f ns "
+              "(dense table %zu bytes)\n",
+              dense, frozen, sizeof(Collector::denseLUT));
+
+  // --- Deserializer::write() ---
+#ifdef RPL_USE_FROZEN_CMD_MAP
+  const char *mode = "frozen map (RPL_USE_FROZEN_CMD_MAP)";
+#else
+  const char *mode = "dense LUT (default)";
+#endif
+  static Des des;
+  std::array<uint8_t, 128> payload{};
+  std::vector<uint16_t> lengths(stream.size());
+  for (size_t i = 0; i < stream.size(); ++i) {
+    const auto *entry = Collector::cmd_entry(stream[i]);
+    lengths[i] = entry ? entry->size : 8;
+  }
+  const double write = Bench::measure_ns(1, [&] {
+    for (size_t i = 0; i < stream.size(); ++i)
+      Bench::do_not_optimize(des.write(stream[i], payload.data(), lengths[i]));
+  }) / static_cast<double>(stream.size());
+  std::printf("Deserializer::write via %s: %.2f ns/frame\n", mode, write);
+  return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file ContentionBench.cpp
+ * @brief SeqLock 多读者竞争基准（伪共享）
+ *
+ * 一个写线程持续写入数据包 Hot，若干读线程各自循环 get<> 另外的小数据包。
+ * 不启用缓存行隔离时这些数据包与 Hot 的版本号、槽位共享缓存行，
+ * 每次写入都会使读者的缓存行失效；启用 RPL_CACHE_LINE_ISOLATION 后
+ * 读者不再受写者影响。输出每个线程每秒完成的操作数。
+ *
+ * @par 构建与运行（仓库根目录）
+ * @code
+ * g++ -std=c++20 -O2 -pthread -Isrc -DRPL_USE_STD_ATOMIC \
+ *     extras/bench/ContentionBench.cpp -o contention_shared
+ * g++ -std=c++20 -O2 -pthread -Isrc -DRPL_USE_STD_ATOMIC \
+ *     -DRPL_CACHE_LINE_ISOLATION extras/bench/ContentionBench.cpp \
+ *     -o contention_isolated
+ * ./contention_shared 3 && ./contention_isolated 3   # 参数为读线程数
+ * @endcode
+ *
+ * @note 需要至少 读线程数 + 1 个物理核心才有意义；单核主机上线程轮流运行，
+ *       不存在缓存行竞争，两种构建的结果没有可比性
+ */
+
+#include "BenchUtil.hpp"
+#include <RPL/Deserializer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#define RPL_BENCH_SMALL_PACKET(Name, Cmd)                                      \
+  struct Name {                                                                \
+    uint32_t value;                                                            \
+  };                                                                           \
+  template <>                                                                  \
+  struct RPL::Meta::PacketTraits<Name>                                         \
+      : PacketTraitsBase<PacketTraits<Name>> {                                 \
+    static constexpr uint16_t cmd = Cmd;                                       \
+    static constexpr size_t size = sizeof(Name);                               \
+  };
+
+RPL_BENCH_SMALL_PACKET(Hot, 0x0A00)
+RPL_BENCH_SMALL_PACKET(Cold1, 0x0A01)
+RPL_BENCH_SMALL_PACKET(Cold2, 0x0A02)
+RPL_BENCH_SMALL_PACKET(Cold3, 0x0A03)
+RPL_BENCH_SMALL_PACKET(Cold4, 0x0A04)
+
+namespace {
+
+using Des = RPL::Deserializer<Hot, Cold1, Cold2, Cold3, Cold4>;
+
+std::atomic<bool> running{true};
+
+template <typename T> void reader(Des &des, uint64_t &ops) {
+  uint64_t n = 0;
+  while (running.load(std::memory_order_relaxed)) {
+    Bench::do_not_optimize(des.get<T>().value);
+    ++n;
+  }
+  ops = n;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const int readers = argc > 1 ? std::clamp(std::atoi(argv[1]), 1, 4) : 3;
+  static Des des;
+
+#ifdef RPL_CACHE_LINE_ISOLATION
+  std::printf("layout: cache-line isolated, ");
+#else
+  std::printf("layout: shared, ");
+#endif
+  std::printf("%d reader(s), %u hardware thread(s)\n", readers,
+              std::thread::hardware_concurrency());
+
+  std::vector<uint64_t> ops(static_cast<size_t>(readers) + 1);
+  std::vector<std::thread> threads;
+  using Reader = void (*)(Des &, uint64_t &);
+  constexpr Reader reader_fns[] = {reader<Cold1>, reader<Cold2>, reader<Cold3>,
+                                   reader<Cold4>};
+  for (int i = 0; i < readers; ++i)
+    threads.emplace_back(reader_fns[i], std::ref(des), std::ref(ops[i + 1]));
+  threads.emplace_back([&] {
+    uint64_t n = 0;
+    Hot packet{};
+    const auto *bytes = reinterpret_cast<const uint8_t *>(&packet);
+    while (running.load(std::memory_order_relaxed)) {
+      packet.value = static_cast<uint32_t>(n++);
+      des.write(RPL::Meta::PacketTraits<Hot>::cmd, bytes, sizeof(packet));
+    }
+    ops[0] = n;
+  });
+
+  constexpr double seconds = 1.0;
+  std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+  running = false;
+  for (auto &t : threads)
+    t.join();
+
+  std::printf("writer: %8.1f M writes/s\n", ops[0] / seconds / 1e6);
+  for (int i = 1; i <= readers; ++i)
+    std::printf("reader %d: %6.1f M gets/s\n", i, ops[i] / seconds / 1e6);
+  return 0;
+}
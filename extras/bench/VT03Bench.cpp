@@ -0,0 +1,81 @@
+/**
+ * @file VT03Bench.cpp
+ * @brief VT03RemotePacket 位流解码基准
+ *
+ * VT03RemotePacket 使用 BitLayout，默认在 get() 时解码。测量：
+ * - Deserializer::get<VT03RemotePacket>()：SeqLock 读取 + 解码
+ * - deserialize_bitstream<VT03RemotePacket>()：单次窗口加载的解码
+ * - 同一布局改用 extract_bits_bytewise() 逐字节解码，作为旧实现的参考
+ *
+ * @par 构建与运行（仓库根目录）
+ * @code
+ * g++ -std=c++20 -O2 -Isrc extras/bench/VT03Bench.cpp -o vt03_bench && ./vt03_bench
+ * @endcode
+ */
+
+#include "BenchUtil.hpp"
+#include <RPL/Deserializer.hpp>
+#include <RPL/Packets/VT03RemotePacket.hpp>
+
+#include <cstdio>
+#include <random>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+using Layout = RPL::Meta::PacketTraits<VT03RemotePacket>::BitLayout;
+constexpr auto fields = std::make_index_sequence<std::tuple_size_v<Layout>>{};
+
+/// @brief 用逐字节实现按 Layout 解码
+template <std::size_t... Is>
+auto bytewise_fields(std::span<const uint8_t> buffer,
+                     std::index_sequence<Is...>) {
+  constexpr auto offsets = [] {
+    std::array<std::size_t, sizeof...(Is) + 1> arr{0};
+    std::size_t current = 0;
+    ((arr[Is + 1] = current += std::tuple_element_t<Is, Layout>::bits), ...);
+    return arr;
+  }();
+  return std::make_tuple(RPL::Detail::extract_bits_bytewise<
+                         typename std::tuple_element_t<Is, Layout>::type,
+                         offsets[Is], std::tuple_element_t<Is, Layout>::bits>(
+      buffer)...);
+}
+
+} // namespace
+
+int main() {
+  std::mt19937 rng(1);
+  uint8_t payload[17];
+  for (auto &b : payload)
+    b = static_cast<uint8_t>(rng());
+
+  static RPL::Deserializer<VT03RemotePacket> des;
+  des.write(RPL::Meta::PacketTraits<VT03RemotePacket>::cmd, payload,
+            sizeof(payload));
+
+  constexpr size_t iterations = 5'000'000;
+  const double get = Bench::measure_ns(iterations, [&] {
+    const auto packet = des.get<VT03RemotePacket>();
+    Bench::do_not_optimize(packet.left_stick_x + packet.mouse_x + packet.key_v);
+  });
+
+  std::span<const uint8_t> buffer{payload};
+  const double decode = Bench::measure_ns(iterations, [&] {
+    Bench::do_not_optimize(buffer);
+    const auto packet = RPL::deserialize_bitstream<VT03RemotePacket>(buffer);
+    Bench::do_not_optimize(packet.left_stick_x + packet.mouse_x + packet.key_v);
+  });
+  const double bytewise = Bench::measure_ns(iterations, [&] {
+    Bench::do_not_optimize(buffer);
+    const auto values = bytewise_fields(buffer, fields);
+    Bench::do_not_optimize(std::get<3>(values) + std::get<11>(values) +
+                           std::get<35>(values));
+  });
+
+  std::printf("get<VT03RemotePacket>():            %6.2f ns\n", get);
+  std::printf("deserialize_bitstream (BitWindow):  %6.2f ns\n", decode);
+  std::printf("bytewise reference decode:          %6.2f ns\n", bytewise);
+  return 0;
+}
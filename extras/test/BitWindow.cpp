@@ -0,0 +1,125 @@
+/**
+ * @file BitWindow.cpp
+ * @brief 单次窗口加载的位提取与逐字节实现的一致性测试 (主机)
+ *
+ * extract_bits() 按 BitWindow 选择 1/2/4/8 字节窗口一次加载，
+ * 结果必须与 extract_bits_bytewise() 完全一致：
+ * - 位偏移 0-71 与多种位宽的组合，覆盖窗口宽度的每个分界
+ * - buffer 比窗口短时回退逐字节实现，超出部分按 0 处理
+ * - VT03RemotePacket 的完整 BitLayout
+ *
+ * @par 构建与运行（仓库根目录）
+ * @code
+ * g++ -std=c++20 -O2 -Isrc extras/test/BitWindow.cpp -o bit_window && ./bit_window
+ * @endcode
+ */
+
+#include <RPL/Meta/BitstreamParser.hpp>
+#include <RPL/Packets/VT03RemotePacket.hpp>
+
+#include <cstdio>
+#include <random>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+using RPL::Detail::BitWindow;
+using RPL::Detail::extract_bits;
+using RPL::Detail::extract_bits_bytewise;
+
+int failures = 0;
+
+void check(bool cond, const char *what) {
+  if (!cond) {
+    std::printf("FAIL: %s\n", what);
+    ++failures;
+  }
+}
+
+/// @brief 窗口必须覆盖字段的全部位，且是满足条件的最小宽度
+template <std::size_t Offset, std::size_t Width> constexpr bool window_ok() {
+  using W = BitWindow<Offset, Width>;
+  if (W::bytes == 0)
+    return W::span_bits > 64;
+  const bool covers = W::first_byte * 8 <= Offset &&
+                      (W::first_byte + W::bytes) * 8 >= Offset + Width;
+  const bool minimal = W::bytes == 1 || W::span_bits > W::bytes * 4;
+  return covers && minimal;
+}
+
+constexpr std::size_t widths[] = {1, 2, 3, 7, 8, 9, 11, 15, 16, 17,
+                                  24, 25, 31, 32, 33, 48, 57, 63, 64};
+
+int mismatches = 0;
+
+template <std::size_t Offset, std::size_t Width>
+void compare_one(std::span<const uint8_t> buffer) {
+  static_assert(window_ok<Offset, Width>());
+  if (extract_bits<uint64_t, Offset, Width>(buffer) !=
+      extract_bits_bytewise<uint64_t, Offset, Width>(buffer))
+    ++mismatches;
+}
+
+template <std::size_t Offset, std::size_t... Ws>
+void compare_widths(std::span<const uint8_t> buffer,
+                    std::index_sequence<Ws...>) {
+  (compare_one<Offset, widths[Ws]>(buffer), ...);
+}
+
+template <std::size_t... Offsets>
+void compare_all(std::span<const uint8_t> buffer,
+                 std::index_sequence<Offsets...>) {
+  (compare_widths<Offsets>(
+       buffer, std::make_index_sequence<std::size(widths)>{}),
+   ...);
+}
+
+/// @brief 用逐字节实现按 Layout 解码，作为参考
+template <typename Layout, std::size_t... Is>
+auto bytewise_fields(std::span<const uint8_t> buffer,
+                     std::index_sequence<Is...>) {
+  constexpr auto offsets = [] {
+    std::array<std::size_t, sizeof...(Is) + 1> arr{0};
+    std::size_t current = 0;
+    ((arr[Is + 1] = current += std::tuple_element_t<Is, Layout>::bits), ...);
+    return arr;
+  }();
+  return std::make_tuple(
+      extract_bits_bytewise<typename std::tuple_element_t<Is, Layout>::type,
+                            offsets[Is],
+                            std::tuple_element_t<Is, Layout>::bits>(buffer)...);
+}
+
+} // namespace
+
+int main() {
+  std::mt19937 rng(1);
+  uint8_t buf[24];
+
+  // 位偏移 × 位宽，buffer 长度从 0 到 24（短 buffer 走回退路径）
+  for (int round = 0; round < 200; ++round) {
+    for (auto &b : buf)
+      b = static_cast<uint8_t>(rng());
+    for (std::size_t len = 0; len <= sizeof(buf); ++len)
+      compare_all({buf, len}, std::make_index_sequence<72>{});
+  }
+  check(mismatches == 0, "extract_bits matches extract_bits_bytewise");
+
+  // VT03RemotePacket 的完整布局
+  using Layout = RPL::Meta::PacketTraits<VT03RemotePacket>::BitLayout;
+  constexpr auto fields = std::make_index_sequence<std::tuple_size_v<Layout>>{};
+  int vt03_mismatches = 0;
+  for (int round = 0; round < 10000; ++round) {
+    for (auto &b : buf)
+      b = static_cast<uint8_t>(rng());
+    const std::span<const uint8_t> payload{buf, 17};
+    if (RPL::Detail::parse_bitstream_impl<Layout>(payload, fields) !=
+        bytewise_fields<Layout>(payload, fields))
+      ++vt03_mismatches;
+  }
+  check(vt03_mismatches == 0, "VT03RemotePacket layout");
+
+  std::puts(failures == 0 ? "OK" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file CaptureRawTap.cpp
+ * @brief Capture 原始字节录制与写入失败处理测试 (POSIX 主机)
+ *
+ * - Writer::attach_raw() 经 Parser::set_raw_tap() 录制 DMA 路径
+ *   （get_write_buffer() / advance_write_index()）与 push_data() 的字节，
+ *   溢出被拒绝的数据块记录为 Dropped，回放得到与现场相同的帧
+ * - 文件大小受限导致 writev() 写入不完整时，文件被截断回上一条记录末尾，
+ *   之后的写入全部忽略
+ *
+ * @par 构建与运行（仓库根目录）
+ * @code
+ * g++ -std=c++20 -O2 -Isrc extras/test/CaptureRawTap.cpp \
+ *     -o capture_raw_tap && ./capture_raw_tap
+ * @endcode
+ */
+
+#include <RPL/Containers/SpscBipBuffer.hpp>
+#include <RPL/Host/Capture.hpp>
+#include <RPL/Packets/Sample/SampleA.hpp>
+#include <RPL/Parser.hpp>
+#include <RPL/Serializer.hpp>
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <sys/resource.h>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void check(bool cond, const char *what) {
+  if (!cond) {
+    std::printf("FAIL: %s\n", what);
+    ++failures;
+  }
+}
+
+std::string temp_path(const char *name) {
+  const char *dir = std::getenv("TMPDIR");
+  return std::string(dir ? dir : "/tmp") + "/" + name;
+}
+
+template <typename T> void count(const RPL::PacketView<T> &, void *user) {
+  ++*static_cast<int *>(user);
+}
+
+/// @brief 生成 frames 个 SampleA 帧（a 为序号）组成的字节流
+std::vector<uint8_t> make_stream(int frames) {
+  RPL::Serializer<SampleA> ser;
+  std::vector<uint8_t> stream;
+  uint8_t frame[64];
+  for (int i = 0; i < frames; ++i) {
+    SampleA packet{};
+    packet.a = static_cast<uint8_t>(i);
+    const size_t n = *ser.serialize(frame, sizeof(frame), packet);
+    stream.insert(stream.end(), frame, frame + n);
+  }
+  return stream;
+}
+
+// DMA 路径：按不规则长度经 get_write_buffer() / advance_write_index() 提交
+void test_dma_path() {
+  const std::string path = temp_path("rpl_raw_tap_dma.rplcap");
+  const auto stream = make_stream(50);
+
+  RPL::Deserializer<SampleA> live_des;
+  RPL::Parser<SampleA> live{live_des};
+  int live_frames = 0;
+  live.on<SampleA>(count<SampleA>, &live_frames);
+
+  RPL::Capture::Writer writer;
+  check(writer.open(path.c_str()), "open capture");
+  writer.attach_raw(live);
+
+  size_t off = 0, step = 1;
+  while (off < stream.size()) {
+    const auto dst = live.get_write_buffer();
+    const size_t n = std::min({dst.size(), stream.size() - off, step});
+    std::memcpy(dst.data(), stream.data() + off, n);
+    (void)live.advance_write_index(n);
+    off += n;
+    step = step % 13 + 1;
+  }
+  RPL::Capture::Writer::detach(live);
+  writer.close();
+  check(live_frames == 50, "live frames");
+
+  RPL::Capture::MappedFile file(path.c_str());
+  RPL::Capture::Reader reader(file.data());
+  std::vector<uint8_t> recorded;
+  RPL::Capture::Record rec{};
+  while (reader.next(rec)) {
+    check(rec.type == RPL::Capture::RecordType::Raw, "raw record");
+    recorded.insert(recorded.end(), rec.data.begin(), rec.data.end());
+  }
+  check(recorded == stream, "recorded bytes match stream");
+
+  RPL::Deserializer<SampleA> des;
+  RPL::Parser<SampleA> replayed{des};
+  int replay_frames = 0;
+  replayed.on<SampleA>(count<SampleA>, &replay_frames);
+  reader.rewind();
+  check(reader.replay(replayed).has_value(), "replay");
+  check(replay_frames == 50, "replayed frames");
+  check(des.get<SampleA>().a == 49, "last replayed frame");
+  std::remove(path.c_str());
+}
+
+// push_data() 溢出：被拒绝的数据块记录为 Dropped
+void test_push_overflow() {
+  const std::string path = temp_path("rpl_raw_tap_drop.rplcap");
+  const auto stream = make_stream(8);
+
+  RPL::Deserializer<SampleA> des;
+  RPL::Parser<RPL::Containers::SpscBipBufferPolicy, SampleA> parser{des};
+  RPL::Capture::Writer writer;
+  check(writer.open(path.c_str()), "open capture");
+  writer.attach_raw(parser);
+
+  int rejected = 0;
+  for (int i = 0; i < 200; ++i) {
+    if (!parser.push_data(stream.data(), stream.size()))
+      ++rejected; // 不解析，缓冲区很快填满
+  }
+  writer.close();
+  check(rejected > 0, "buffer overflowed");
+
+  RPL::Capture::MappedFile file(path.c_str());
+  RPL::Capture::Reader reader(file.data());
+  RPL::Capture::Record rec{};
+  int raw = 0, dropped = 0;
+  while (reader.next(rec))
+    ++(rec.type == RPL::Capture::RecordType::Dropped ? dropped : raw);
+  check(raw == 200 - rejected, "raw records");
+  check(dropped == rejected, "dropped records");
+  std::remove(path.c_str());
+}
+
+// writev() 写入不完整：截断回上一条记录并停止录制
+void test_short_write() {
+  const std::string path = temp_path("rpl_raw_tap_short.rplcap");
+  std::signal(SIGXFSZ, SIG_IGN);
+  rlimit old{};
+  getrlimit(RLIMIT_FSIZE, &old);
+  // 文件头 16 字节 + 两条 40 字节的记录，第三条只能写入 4 字节
+  rlimit limit = old;
+  limit.rlim_cur = 100;
+  setrlimit(RLIMIT_FSIZE, &limit);
+
+  RPL::Capture::Writer writer;
+  check(writer.open(path.c_str()), "open capture");
+  const uint8_t data[24]{};
+  check(writer.write_raw(data), "first record");
+  check(writer.write_raw(data), "second record");
+  check(!writer.write_raw(data), "third record fails");
+  check(writer.failed(), "failed flag");
+  check(writer.file_size() == 96, "size excludes partial record");
+
+  setrlimit(RLIMIT_FSIZE, &old);
+  check(!writer.write_raw(data), "writes stop after failure");
+  writer.close();
+
+  RPL::Capture::MappedFile file(path.c_str());
+  check(file.data().size() == 96, "partial record truncated");
+  RPL::Capture::Reader reader(file.data());
+  RPL::Capture::Record rec{};
+  int records = 0;
+  while (reader.next(rec))
+    ++records;
+  check(records == 2, "complete records readable");
+  std::remove(path.c_str());
+}
+
+} // namespace
+
+int main() {
+  test_dma_path();
+  test_push_overflow();
+  test_short_write();
+
+  std::puts(failures == 0 ? "OK" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
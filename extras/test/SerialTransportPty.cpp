@@ -0,0 +1,166 @@
+/**
+ * @file SerialTransportPty.cpp
+ * @brief SerialTransport 伪终端测试 (Linux)
+ *
+ * 通过 open_pty() 创建伪终端，向主端写入帧，由 SerialTransport
+ * 打开从端接收，无需真实串口：
+ * - 分块写入的帧全部经 poll() 送达 Parser，Stats 统计每次 read()
+ * - Parser 缓冲区已满时暂停监听：重复 poll() 不再空转，
+ *   消费者解析腾出空间后恢复接收且不丢数据
+ *
+ * @par 构建与运行（仓库根目录）
+ * @code
+ * g++ -std=c++20 -O2 -Isrc extras/test/SerialTransportPty.cpp \
+ *     -o serial_pty && ./serial_pty
+ * @endcode
+ */
+
+#include <RPL/Containers/SpscBipBuffer.hpp>
+#include <RPL/Host/SerialTransport.hpp>
+#include <RPL/Packets/Sample/SampleA.hpp>
+#include <RPL/Parser.hpp>
+#include <RPL/Serializer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void check(bool cond, const char *what) {
+  if (!cond) {
+    std::printf("FAIL: %s\n", what);
+    ++failures;
+  }
+}
+
+template <typename T> void count(const RPL::PacketView<T> &, void *user) {
+  ++*static_cast<int *>(user);
+}
+
+/// @brief 生成 frames 个 SampleA 帧（a 为序号）组成的字节流
+std::vector<uint8_t> make_stream(int frames) {
+  RPL::Serializer<SampleA> ser;
+  std::vector<uint8_t> stream;
+  uint8_t frame[64];
+  for (int i = 0; i < frames; ++i) {
+    SampleA packet{};
+    packet.a = static_cast<uint8_t>(i);
+    const size_t n = *ser.serialize(frame, sizeof(frame), packet);
+    stream.insert(stream.end(), frame, frame + n);
+  }
+  return stream;
+}
+
+/// @brief 向 pty 主端写入全部数据
+bool write_all(int fd, const uint8_t *data, size_t len) {
+  while (len > 0) {
+    const ssize_t n = ::write(fd, data, len);
+    if (n <= 0)
+      return false;
+    data += n;
+    len -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+void test_receive() {
+  const auto pty = RPL::open_pty();
+  check(pty.master >= 0, "open_pty");
+  if (pty.master < 0)
+    return;
+
+  RPL::Deserializer<SampleA> des;
+  RPL::Parser<SampleA> parser{des};
+  int frames = 0;
+  parser.on<SampleA>(count<SampleA>, &frames);
+  RPL::SerialTransport transport{parser};
+  check(transport.open(pty.slave_path.data(), 921600), "open slave");
+
+  const auto stream = make_stream(200);
+  size_t off = 0;
+  while (off < stream.size() || frames < 200) {
+    if (off < stream.size()) {
+      const size_t n = std::min<size_t>(37, stream.size() - off);
+      check(write_all(pty.master, stream.data() + off, n), "write master");
+      off += n;
+    }
+    const auto r = transport.poll(100);
+    check(r.has_value(), "poll");
+    if (!r || (*r == 0 && off == stream.size()))
+      break;
+  }
+
+  const auto &stats = transport.stats();
+  check(frames == 200, "all frames received");
+  check(des.get<SampleA>().a == 199, "last frame");
+  check(stats.bytes == stream.size(), "byte count");
+  check(stats.reads > 0 && stats.overflows == 0, "read count");
+  check(stats.min_latency_ns <= stats.mean_latency_ns() &&
+            stats.mean_latency_ns() <= stats.max_latency_ns,
+        "latency stats");
+
+  transport.close();
+  ::close(pty.master);
+}
+
+void test_full_buffer_pauses() {
+  const auto pty = RPL::open_pty();
+  check(pty.master >= 0, "open_pty");
+  if (pty.master < 0)
+    return;
+
+  // parse_on_write 为 false：只有 try_parse_packets() 才会腾出空间
+  RPL::Deserializer<SampleA> des;
+  RPL::Parser<RPL::Containers::SpscBipBufferPolicy, SampleA> parser{des};
+  int frames = 0;
+  parser.on<SampleA>(count<SampleA>, &frames);
+  RPL::SerialTransport transport{parser};
+  check(transport.open(pty.slave_path.data(), 921600), "open slave");
+
+  constexpr int total = 100;
+  const auto stream = make_stream(total);
+  check(write_all(pty.master, stream.data(), stream.size()), "write master");
+
+  (void)transport.poll(100);
+  check(transport.stats().overflows == 1, "buffer filled");
+
+  // 暂停期间 poll() 不再被水平触发的可读事件立即唤醒
+  const auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < 20; ++i)
+    check(transport.poll(0).value_or(1) == 0, "paused poll reads nothing");
+  (void)transport.poll(5);
+  const auto elapsed = std::chrono::steady_clock::now() - begin;
+  check(elapsed >= std::chrono::milliseconds(1), "paused poll backs off");
+  check(transport.stats().overflows == 1, "no repeated overflow");
+
+  // 消费者腾出空间后恢复接收
+  for (int i = 0; i < 1000 && frames < total; ++i) {
+    (void)parser.try_parse_packets();
+    (void)transport.poll(10);
+  }
+  (void)parser.try_parse_packets();
+  check(frames == total, "all frames received after resume");
+  check(transport.stats().bytes == stream.size(), "no bytes lost");
+
+  transport.close();
+  ::close(pty.master);
+}
+
+} // namespace
+
+int main() {
+  std::signal(SIGALRM, [](int) { std::_Exit(2); });
+  ::alarm(10);
+
+  test_receive();
+  test_full_buffer_pauses();
+
+  std::puts(failures == 0 ? "OK" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
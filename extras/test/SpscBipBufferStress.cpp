@@ -0,0 +1,204 @@
+/**
+ * @file SpscBipBufferStress.cpp
+ * @brief SpscBipBuffer + Parser 双线程压力测试 (Linux 主机)
+ *
+ * 生产者线程模拟 DMA：以随机长度经 get_write_buffer() / advance_write_index()
+ * 提交 SampleA 帧与噪声字节；消费者线程循环调用 try_parse_packets()，
+ * 通过 CallbackConnectionMonitor 统计帧数，并用 get<SampleA>() 检查
+ * 帧序号单调递增。另有一个确定性用例，在消费者的 available()
+ * 与 get_contiguous_read_buffer() 之间注入一次生产者提交——
+ * 单核主机上双线程运行几乎无法命中这个窗口。
+ *
+ * @par 构建与运行（仓库根目录）
+ * @code
+ * g++ -std=c++20 -O2 -pthread -Isrc extras/test/SpscBipBufferStress.cpp \
+ *     -o spsc_stress && ./spsc_stress
+ * @endcode
+ *
+ * 任何用例在 10 秒内未完成视为死锁，进程以非零状态退出。
+ */
+
+#include <RPL/Containers/SpscBipBuffer.hpp>
+#include <RPL/Packets/Sample/SampleA.hpp>
+#include <RPL/Parser.hpp>
+#include <RPL/Serializer.hpp>
+#include <RPL/Utils/ConnectionMonitor.hpp>
+
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+/// @brief 下一次 get_contiguous_read_buffer() 前执行的回调（执行一次后清空）
+void (*inject)() = nullptr;
+
+/**
+ * @brief 在 get_contiguous_read_buffer() 之前执行一次注入回调的 SpscBipBuffer
+ *
+ * 模拟生产者恰好在消费者读取 available() 之后提交数据。
+ */
+template <size_t SIZE>
+class InjectingBuffer : public RPL::Containers::SpscBipBuffer<SIZE> {
+public:
+  [[nodiscard]] std::span<const uint8_t>
+  get_contiguous_read_buffer() const noexcept {
+    if (auto fn = inject) {
+      inject = nullptr;
+      fn();
+    }
+    return RPL::Containers::SpscBipBuffer<SIZE>::get_contiguous_read_buffer();
+  }
+};
+
+struct InjectingBufferPolicy {
+  template <size_t SIZE> using buffer_type = InjectingBuffer<SIZE>;
+  static constexpr bool parse_on_write = false;
+};
+
+/// @brief 统计成功解析的帧数
+struct FrameCounter {
+  static void on_packet() { ++count; }
+  static inline uint32_t count = 0;
+};
+using Monitor = RPL::CallbackConnectionMonitor<FrameCounter>;
+
+using Deserializer = RPL::Deserializer<SampleA>;
+using SpscParser =
+    RPL::Parser<RPL::Containers::SpscBipBufferPolicy, Monitor, SampleA>;
+using InjectingParser = RPL::Parser<InjectingBufferPolicy, Monitor, SampleA>;
+
+int failures = 0;
+
+void check(bool cond, const char *what) {
+  if (!cond) {
+    std::printf("FAIL: %s\n", what);
+    ++failures;
+  }
+}
+
+// --- 确定性用例：生产者在 available() 与读视图之间提交 ---
+
+InjectingParser *injecting_parser = nullptr;
+
+void test_commit_between_available_and_view() {
+  Deserializer des;
+  InjectingParser parser{des};
+  injecting_parser = &parser;
+  FrameCounter::count = 0;
+
+  // 4 字节噪声已在缓冲区中，消费者读到 available() == 4 后生产者再提交 8 字节
+  const uint8_t noise[4] = {0x01, 0x02, 0x03, 0x04};
+  check(parser.push_data(noise, sizeof(noise)).has_value(), "push noise");
+  inject = [] {
+    const uint8_t more[8] = {0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18};
+    (void)injecting_parser->push_data(more, sizeof(more));
+  };
+  check(parser.try_parse_packets().has_value(), "parse with noise");
+  check(parser.available_data() == 0, "noise fully discarded");
+
+  // 注入一个完整帧，确认解析器仍然可用
+  RPL::Serializer<SampleA> ser;
+  uint8_t frame[64];
+  SampleA packet{};
+  packet.a = 7;
+  const size_t n = *ser.serialize(frame, sizeof(frame), packet);
+  check(parser.push_data(noise, sizeof(noise)).has_value(), "push noise 2");
+  static uint8_t pending[64];
+  static size_t pending_len = 0;
+  std::memcpy(pending, frame, n);
+  pending_len = n;
+  inject = [] {
+    (void)injecting_parser->push_data(pending, pending_len);
+  };
+  check(parser.try_parse_packets().has_value(), "parse injected frame");
+  check(FrameCounter::count == 1, "injected frame parsed");
+  check(des.get<SampleA>().a == 7, "injected frame content");
+}
+
+// --- 双线程压力用例 ---
+
+constexpr uint32_t stress_frames = 200000;
+
+std::atomic<bool> producer_done{false};
+
+void test_two_thread_stress() {
+  Deserializer des;
+  SpscParser parser{des};
+  FrameCounter::count = 0;
+  double last_seq = -1.0;
+  uint32_t out_of_order = 0;
+
+  std::thread producer([&] {
+    RPL::Serializer<SampleA> ser;
+    std::mt19937 rng(1);
+    uint8_t stream[256];
+    for (uint32_t i = 0; i < stress_frames; ++i) {
+      size_t len = 0;
+      for (int k = static_cast<int>(rng() % 4); k > 0; --k)
+        stream[len++] = static_cast<uint8_t>(rng() % 0xA0); // 不含起始字节
+      SampleA a{};
+      a.d = static_cast<double>(i); // 帧序号
+      len += *ser.serialize(stream + len, sizeof(stream) - len, a);
+
+      // 以随机长度分段提交，模拟 DMA 半满/空闲中断
+      size_t off = 0;
+      while (off < len) {
+        const auto dst = parser.get_write_buffer();
+        if (dst.empty()) {
+          std::this_thread::yield();
+          continue;
+        }
+        const size_t chunk =
+            std::min({dst.size(), len - off, size_t{1} + rng() % 24});
+        std::memcpy(dst.data(), stream + off, chunk);
+        (void)parser.advance_write_index(chunk);
+        off += chunk;
+      }
+    }
+    producer_done.store(true, std::memory_order_release);
+  });
+
+  while (!producer_done.load(std::memory_order_acquire) ||
+         parser.available_data() > 0) {
+    const uint32_t before = FrameCounter::count;
+    (void)parser.try_parse_packets();
+    if (FrameCounter::count == before) {
+      std::this_thread::yield(); // 只剩不完整帧，让出 CPU 给生产者
+      continue;
+    }
+    const double seq = des.get<SampleA>().d;
+    if (seq < last_seq)
+      ++out_of_order;
+    last_seq = seq;
+  }
+  producer.join();
+
+  std::printf("stress: %u/%u frames, %u out of order\n", FrameCounter::count,
+              stress_frames, out_of_order);
+  check(FrameCounter::count == stress_frames, "all frames received");
+  check(out_of_order == 0, "frames in order");
+  check(last_seq == static_cast<double>(stress_frames - 1), "last frame");
+}
+
+} // namespace
+
+int main() {
+  std::signal(SIGALRM, [](int) {
+    static const char msg[] = "FAIL: timeout (parser deadlock)\n";
+    ::write(STDOUT_FILENO, msg, sizeof(msg) - 1);
+    std::_Exit(2);
+  });
+  ::alarm(10);
+
+  test_commit_between_available_and_view();
+  test_two_thread_stress();
+
+  std::puts(failures == 0 ? "OK" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file SubPacketDispatch.cpp
+ * @brief 子数据包回调分发测试 (主机)
+ *
+ * 父数据包与子数据包各自按 PacketTraits::length_policy 校验长度，
+ * 只有实际写入内存池的一方触发 on<T>() 回调。
+ *
+ * @par 构建与运行（仓库根目录）
+ * @code
+ * g++ -std=c++20 -O2 -Isrc extras/test/SubPacketDispatch.cpp \
+ *     -o sub_dispatch && ./sub_dispatch
+ * @endcode
+ */
+
+#include <RPL/Packets/RoboMaster/RobotInteractionData.hpp>
+#include <RPL/Parser.hpp>
+#include <RPL/Serializer.hpp>
+
+#include <cstdio>
+#include <cstring>
+
+/// @brief 长度严格为 3 字节的子数据包
+struct StrictMode {
+  uint8_t mode;
+  uint16_t param;
+} __attribute__((packed));
+
+template <>
+struct RPL::Meta::PacketTraits<StrictMode>
+    : PacketTraitsBase<PacketTraits<StrictMode>> {
+  static constexpr uint16_t cmd = 0x0301;
+  static constexpr uint16_t sub_cmd = 0x0201;
+  static constexpr size_t size = sizeof(StrictMode);
+};
+
+/// @brief 长度严格匹配的父数据包（子帧头 2 字节子命令码 + 4 字节内容）
+struct StrictParent {
+  uint16_t sub_cmd;
+  uint8_t body[4];
+} __attribute__((packed));
+
+template <>
+struct RPL::Meta::PacketTraits<StrictParent>
+    : PacketTraitsBase<PacketTraits<StrictParent>> {
+  static constexpr uint16_t cmd = 0x0400;
+  static constexpr size_t size = sizeof(StrictParent);
+};
+
+/// @brief 同一父命令码下变长的子数据包（最长 8 字节）
+struct LooseChild {
+  uint8_t value[8];
+} __attribute__((packed));
+
+template <>
+struct RPL::Meta::PacketTraits<LooseChild>
+    : PacketTraitsBase<PacketTraits<LooseChild>> {
+  static constexpr uint16_t cmd = 0x0400;
+  static constexpr uint16_t sub_cmd = 0x0001;
+  static constexpr size_t size = sizeof(LooseChild);
+  static constexpr size_t sub_header_size = 2;
+  static constexpr LengthPolicy length_policy = LengthPolicy::TruncateOrPad;
+};
+
+/// @brief 仅用于发送：与 StrictParent 同命令码但更长
+struct LongParent {
+  uint16_t sub_cmd;
+  uint8_t body[8];
+} __attribute__((packed));
+
+template <>
+struct RPL::Meta::PacketTraits<LongParent>
+    : PacketTraitsBase<PacketTraits<LongParent>> {
+  static constexpr uint16_t cmd = 0x0400;
+  static constexpr size_t size = sizeof(LongParent);
+};
+
+namespace {
+
+int failures = 0;
+
+void check(bool cond, const char *what) {
+  if (!cond) {
+    std::printf("FAIL: %s\n", what);
+    ++failures;
+  }
+}
+
+template <typename T> void count(const RPL::PacketView<T> &, void *user) {
+  ++*static_cast<int *>(user);
+}
+
+template <typename ParserT, typename T>
+void feed(ParserT &parser, const T &packet) {
+  RPL::Serializer<T> ser;
+  uint8_t frame[256];
+  const size_t n = *ser.serialize(frame, sizeof(frame), packet);
+  (void)parser.push_data(frame, n);
+}
+
+// 子数据包长度被拒绝：只触发父数据包回调
+void test_rejected_sub() {
+  RPL::Deserializer<RobotInteractionData, StrictMode> des;
+  RPL::Parser<RobotInteractionData, StrictMode> parser{des};
+  int parents = 0, subs = 0;
+  parser.on<RobotInteractionData>(count<RobotInteractionData>, &parents);
+  parser.on<StrictMode>(count<StrictMode>, &subs);
+
+  RobotInteractionData r{};
+  r.data_cmd_id = 0x0201; // 内容长度 112 字节，StrictMode 要求 3 字节
+  feed(parser, r);
+  check(parents == 1, "parent handler fired");
+  check(subs == 0, "rejected sub handler not fired");
+}
+
+// 父数据包长度被拒绝：只触发子数据包回调
+void test_rejected_parent() {
+  RPL::Deserializer<StrictParent, LooseChild> des;
+  RPL::Parser<StrictParent, LooseChild> parser{des};
+  int parents = 0, subs = 0;
+  parser.on<StrictParent>(count<StrictParent>, &parents);
+  parser.on<LooseChild>(count<LooseChild>, &subs);
+
+  LongParent longer{};
+  longer.sub_cmd = 0x0001;
+  longer.body[0] = 0x5A;
+  feed(parser, longer);
+  check(parents == 0, "rejected parent handler not fired");
+  check(subs == 1, "sub handler fired");
+  check(des.get<LooseChild>().value[0] == 0x5A, "sub content");
+
+  StrictParent exact{};
+  exact.sub_cmd = 0x0001;
+  feed(parser, exact);
+  check(parents == 1, "parent handler fired");
+  check(subs == 2, "sub handler fired again");
+}
+
+} // namespace
+
+int main() {
+  test_rejected_sub();
+  test_rejected_parent();
+
+  std::puts(failures == 0 ? "OK" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
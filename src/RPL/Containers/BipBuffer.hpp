@@ -438,6 +438,17 @@ public:
   }
 };
 
+/**
+ * @brief Parser 缓冲区策略：默认双区缓冲区
+ *
+ * 写入与解析在同一上下文中执行，push_data() / advance_write_index()
+ * 提交数据后立即尝试解析。
+ */
+struct BipBufferPolicy {
+  template <size_t SIZE> using buffer_type = BipBuffer<SIZE>;
+  static constexpr bool parse_on_write = true; ///< 写入后立即解析
+};
+
 } // namespace RPL::Containers
 
 #endif // RPL_BIPBUFFER_HPP
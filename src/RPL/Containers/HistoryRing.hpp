@@ -0,0 +1,179 @@
+/**
+ * @file HistoryRing.hpp
+ * @brief RPL 定长记录的单生产者单消费者历史环形队列
+ *
+ * 用于在 Deserializer 中为事件型数据包（HurtData、ShootData、
+ * RefereeWarning 等）保留每一条记录，而不是只保留最新值。
+ *
+ * @par 设计原理
+ * - 每条记录为固定大小的原始负载加上单调递增的序号
+ * - head_ 仅由生产者 (Parser) 修改，tail_ 仅由消费者修改，无需加锁
+ * - 队列满时丢弃新记录并计数，已入队的记录在被消费前不会被覆盖
+ * - 与 Deserializer 相同，定义 RPL_USE_STD_ATOMIC 时使用原子变量，
+ *   否则使用 volatile + compiler barrier（适用于单核 MCU）
+ */
+
+#ifndef RPL_HISTORY_RING_HPP
+#define RPL_HISTORY_RING_HPP
+
+#include "RPL/Utils/CompilerBarrier.hpp"
+#ifdef RPL_USE_STD_ATOMIC
+#include <atomic>
+#endif
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace RPL::Containers {
+
+/**
+ * @brief 定长记录的 SPSC 历史环形队列
+ *
+ * @tparam RecordSize 每条记录的负载字节数
+ * @tparam Depth 队列深度，必须是 2 的幂
+ */
+template <size_t RecordSize, size_t Depth> class HistoryRing {
+  static_assert(Depth > 0 && (Depth & (Depth - 1)) == 0,
+                "Depth must be a power of 2");
+
+  struct Record {
+    uint32_t seq;
+    uint8_t data[RecordSize];
+  };
+
+  Record records_[Depth]{};
+
+#ifdef RPL_USE_STD_ATOMIC
+  std::atomic<uint32_t> head_{0};     ///< 写计数（生产者）
+  std::atomic<uint32_t> tail_{0};     ///< 读计数（消费者）
+  std::atomic<uint32_t> overflow_{0}; ///< 因队列满被丢弃的记录数
+#else
+  volatile uint32_t head_{0};
+  volatile uint32_t tail_{0};
+  volatile uint32_t overflow_{0};
+#endif
+  uint32_t next_seq_{0}; ///< 下一条记录的序号（生产者独占）
+
+  uint32_t load_head() const noexcept {
+#ifdef RPL_USE_STD_ATOMIC
+    return head_.load(std::memory_order_acquire);
+#else
+    const uint32_t v = head_;
+    compiler_barrier();
+    return v;
+#endif
+  }
+
+  uint32_t load_tail() const noexcept {
+#ifdef RPL_USE_STD_ATOMIC
+    return tail_.load(std::memory_order_acquire);
+#else
+    const uint32_t v = tail_;
+    compiler_barrier();
+    return v;
+#endif
+  }
+
+public:
+  /**
+   * @brief 追加一条记录（生产者）
+   *
+   * 负载由两段拼接而成，不足 RecordSize 的部分补零，超出部分截断。
+   * 无论是否入队成功，序号都会递增，消费者可据此发现丢失的记录。
+   *
+   * @param s1 第一段负载
+   * @param s2 第二段负载（可能为空）
+   * @return true 如果成功入队；队列已满时返回 false
+   */
+  bool push(std::span<const uint8_t> s1, std::span<const uint8_t> s2) noexcept {
+    const uint32_t seq = next_seq_++;
+#ifdef RPL_USE_STD_ATOMIC
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+#else
+    const uint32_t head = head_;
+#endif
+    if (head - load_tail() >= Depth) {
+#ifdef RPL_USE_STD_ATOMIC
+      overflow_.fetch_add(1, std::memory_order_relaxed);
+#else
+      overflow_ = overflow_ + 1;
+#endif
+      return false;
+    }
+
+    Record &rec = records_[head & (Depth - 1)];
+    rec.seq = seq;
+    const size_t n1 = s1.size() < RecordSize ? s1.size() : RecordSize;
+    const size_t rest = RecordSize - n1;
+    const size_t n2 = s2.size() < rest ? s2.size() : rest;
+    if (n1 > 0)
+      std::memcpy(rec.data, s1.data(), n1);
+    if (n2 > 0)
+      std::memcpy(rec.data + n1, s2.data(), n2);
+    if (n1 + n2 < RecordSize)
+      std::memset(rec.data + n1 + n2, 0, RecordSize - n1 - n2);
+
+#ifdef RPL_USE_STD_ATOMIC
+    head_.store(head + 1, std::memory_order_release);
+#else
+    compiler_barrier();
+    head_ = head + 1;
+#endif
+    return true;
+  }
+
+  /**
+   * @brief 取出最早的一条记录（消费者）
+   *
+   * @param seq 输出记录序号
+   * @param out 输出负载，至少 RecordSize 字节
+   * @return true 如果取到记录；队列为空时返回 false
+   */
+  bool pop(uint32_t &seq, uint8_t *out) noexcept {
+#ifdef RPL_USE_STD_ATOMIC
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+#else
+    const uint32_t tail = tail_;
+#endif
+    if (load_head() == tail)
+      return false;
+
+    const Record &rec = records_[tail & (Depth - 1)];
+    seq = rec.seq;
+    std::memcpy(out, rec.data, RecordSize);
+
+#ifdef RPL_USE_STD_ATOMIC
+    tail_.store(tail + 1, std::memory_order_release);
+#else
+    compiler_barrier();
+    tail_ = tail + 1;
+#endif
+    return true;
+  }
+
+  /// @brief 当前可读记录数（消费者）
+  size_t available() const noexcept {
+#ifdef RPL_USE_STD_ATOMIC
+    return load_head() - tail_.load(std::memory_order_relaxed);
+#else
+    return load_head() - tail_;
+#endif
+  }
+
+  /// @brief 因队列满而被丢弃的记录数
+  uint32_t overflow_count() const noexcept {
+#ifdef RPL_USE_STD_ATOMIC
+    return overflow_.load(std::memory_order_relaxed);
+#else
+    return overflow_;
+#endif
+  }
+
+  /// @brief 队列深度
+  static constexpr size_t depth() { return Depth; }
+};
+
+} // namespace RPL::Containers
+
+#endif // RPL_HISTORY_RING_HPP
@@ -30,9 +30,10 @@ namespace RPL::Containers
      * 用于管理反序列化数据的内存分配，通过预分配固定大小的内存块来避免动态分配。
      * 内存池的大小在编译期由 Collector::totalSize 确定。
      *
-     * @tparam Collector 用于收集包信息的类型，必须提供 totalSize 静态常量
+     * @tparam Collector 用于收集包信息的类型，必须提供 totalSize 与 poolAlignment 静态常量
      *
-     * @note 内存缓冲区使用 std::max_align_t 对齐，以确保任何数据类型的访问都是安全的
+     * @note 内存缓冲区至少按 std::max_align_t 对齐，以确保任何数据类型的访问都是安全的；
+     *       启用 RPL_CACHE_LINE_ISOLATION 时按缓存行对齐
      */
     template <typename Collector>
     struct MemoryPool
@@ -40,10 +41,10 @@ namespace RPL::Containers
         /**
          * @brief 预分配的内存缓冲区
          *
-         * 使用 std::max_align_t 对齐的静态内存缓冲区，
+         * 按 Collector::poolAlignment 对齐的静态内存缓冲区，
          * 大小由 Collector::totalSize 在编译期确定。
          */
-        alignas(std::max_align_t) std::array<std::byte, Collector::totalSize> buffer{};  ///< 预分配的内存缓冲区
+        alignas(Collector::poolAlignment) std::array<std::byte, Collector::totalSize> buffer{};  ///< 预分配的内存缓冲区
     };
 }
 
@@ -0,0 +1,293 @@
+/**
+ * @file MirroredBuffer.hpp
+ * @brief RPL 虚拟内存镜像环形缓冲区实现 (Linux)
+ *
+ * 通过 memfd_create 创建匿名内存文件，并将同一组物理页连续映射两次，
+ * 使得 [base, base + capacity) 与 [base + capacity, base + 2 * capacity)
+ * 指向相同的数据。任意起点、长度不超过 capacity 的区域在虚拟地址上
+ * 都是连续的，因此环形缓冲区的回绕对读写双方完全透明。
+ *
+ * @par 设计原理
+ * - head_ / tail_ 为单调递增的读写计数，取模 capacity 得到实际偏移
+ * - get_read_spans() 始终只返回第一个 span，第二个 span 恒为空
+ * - get_write_buffer() 始终返回全部空闲空间，不存在"尾部不足"的情况
+ * - 配合 MirroredBufferPolicy 使用时，Parser 在编译期跳过帧头栈拷贝、
+ *   分段 CRC 与分段反序列化等回绕处理逻辑
+ *
+ * @par 容量
+ * 实际容量为 SIZE 与系统页大小中较大者（均为 2 的幂），
+ * 映射失败时容量为 0，所有写入都会失败，可通过 is_mapped() 检查。
+ *
+ * @note 仅适用于 Linux 主机 (需要 memfd_create，glibc >= 2.27)，
+ *       不会被 Parser.hpp 自动包含
+ *
+ * @code
+ * #include <RPL/Containers/MirroredBuffer.hpp>
+ *
+ * RPL::Parser<RPL::Containers::MirroredBufferPolicy, PacketA, PacketB>
+ *     parser{deserializer};
+ * @endcode
+ */
+
+#ifndef RPL_MIRRORED_BUFFER_HPP
+#define RPL_MIRRORED_BUFFER_HPP
+
+#if !defined(__linux__)
+#error "MirroredBuffer requires Linux (memfd_create + mmap)"
+#endif
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <utility>
+
+namespace RPL::Containers {
+
+/**
+ * @brief 虚拟内存镜像环形缓冲区类
+ *
+ * 与 BipBuffer 提供相同的读写接口，但所有可读数据始终连续。
+ * 与 BipBuffer 相同，不保证线程安全。
+ *
+ * @tparam SIZE 最小缓冲区大小，必须是 2 的幂
+ */
+template <size_t SIZE> class MirroredBuffer {
+  static_assert((SIZE & (SIZE - 1)) == 0, "SIZE must be a power of 2");
+
+  uint8_t *base_{nullptr}; ///< 第一份映射的起始地址
+  size_t capacity_{0};     ///< 单份映射的大小
+  size_t head_{0};         ///< 读计数（单调递增）
+  size_t tail_{0};         ///< 写计数（单调递增）
+
+  /**
+   * @brief 建立双重映射
+   * @return true 如果映射成功
+   */
+  bool map() noexcept {
+    const long page = ::sysconf(_SC_PAGESIZE);
+    if (page <= 0)
+      return false;
+    const size_t cap =
+        std::bit_ceil(std::max<size_t>(SIZE, static_cast<size_t>(page)));
+
+    const int fd = ::memfd_create("rpl_mirrored_buffer", MFD_CLOEXEC);
+    if (fd < 0)
+      return false;
+    if (::ftruncate(fd, static_cast<off_t>(cap)) != 0) {
+      ::close(fd);
+      return false;
+    }
+
+    // 先保留 2 * cap 的连续地址空间，再把内存文件覆盖映射到前后两半
+    void *reserved = ::mmap(nullptr, 2 * cap, PROT_NONE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED) {
+      ::close(fd);
+      return false;
+    }
+    auto *base = static_cast<uint8_t *>(reserved);
+    void *first = ::mmap(base, cap, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_FIXED, fd, 0);
+    void *second = ::mmap(base + cap, cap, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_FIXED, fd, 0);
+    ::close(fd); // 映射会保持对内存文件的引用
+    if (first == MAP_FAILED || second == MAP_FAILED) {
+      ::munmap(base, 2 * cap);
+      return false;
+    }
+
+    base_ = base;
+    capacity_ = cap;
+    return true;
+  }
+
+public:
+  MirroredBuffer() noexcept { map(); }
+
+  ~MirroredBuffer() {
+    if (base_)
+      ::munmap(base_, 2 * capacity_);
+  }
+
+  MirroredBuffer(const MirroredBuffer &) = delete;
+  MirroredBuffer &operator=(const MirroredBuffer &) = delete;
+
+  /**
+   * @brief 检查双重映射是否建立成功
+   * @return true 如果缓冲区可用
+   */
+  [[nodiscard]] bool is_mapped() const noexcept { return base_ != nullptr; }
+
+  /**
+   * @brief 获取连续缓冲区用于写入
+   *
+   * @return 覆盖全部空闲空间的连续内存 span，如果缓冲区已满则返回空 span
+   * @note 此方法支持零拷贝 DMA 写入
+   */
+  std::span<uint8_t> get_write_buffer() noexcept {
+    if (!base_)
+      return {};
+    return {base_ + (tail_ & (capacity_ - 1)), space()};
+  }
+
+  /**
+   * @brief 提交写入
+   *
+   * @param length 已写入的字节数
+   * @return true 如果成功提交
+   * @return false 如果提交长度超出空闲空间
+   */
+  bool advance_write_index(size_t length) noexcept {
+    if (length > space())
+      return false;
+    tail_ += length;
+    return true;
+  }
+
+  /**
+   * @brief 复制数据到缓冲区
+   *
+   * @param data 指向源数据的指针
+   * @param length 要写入的字节数
+   * @return true 如果成功写入
+   * @return false 如果没有足够的空间
+   */
+  bool write(const uint8_t *data, size_t length) noexcept {
+    if (length == 0)
+      return true;
+    if (length > space())
+      return false;
+    std::memcpy(base_ + (tail_ & (capacity_ - 1)), data, length);
+    tail_ += length;
+    return true;
+  }
+
+  /**
+   * @brief 获取连续数据用于读取
+   *
+   * @return 覆盖全部可读数据的连续内存 span，如果没有数据则返回空 span
+   */
+  [[nodiscard]] std::span<const uint8_t>
+  get_contiguous_read_buffer() const noexcept {
+    if (!base_)
+      return {};
+    return {base_ + (head_ & (capacity_ - 1)), available()};
+  }
+
+  /**
+   * @brief 丢弃数据
+   *
+   * @param length 要丢弃的字节数
+   * @return true 如果成功丢弃
+   * @return false 如果请求长度超过可用数据量
+   */
+  bool discard(size_t length) noexcept {
+    if (length > available())
+      return false;
+    head_ += length;
+    return true;
+  }
+
+  /**
+   * @brief 获取读视图
+   *
+   * @param offset 相对于可用数据的偏移量
+   * @param length 要读取的长度
+   * @return std::pair 包含两个 span，第二个 span 恒为空。
+   *         如果请求超出范围，两个 span 都为空。
+   */
+  [[nodiscard]] std::pair<std::span<const uint8_t>, std::span<const uint8_t>>
+  get_read_spans(size_t offset, size_t length) const noexcept {
+    if (offset + length > available())
+      return {{}, {}};
+    return {{base_ + ((head_ + offset) & (capacity_ - 1)), length}, {}};
+  }
+
+  /**
+   * @brief 获取可用数据字节数
+   * @return 当前缓冲区中可读数据的总字节数
+   */
+  size_t available() const noexcept { return tail_ - head_; }
+
+  /**
+   * @brief 获取可用写入空间
+   * @return 空闲字节数（始终连续）
+   */
+  size_t space() const noexcept { return capacity_ - available(); }
+
+  /**
+   * @brief 检查缓冲区是否已满
+   * @return true 如果没有可用写入空间
+   */
+  bool full() const noexcept { return space() == 0; }
+
+  /**
+   * @brief 检查缓冲区是否为空
+   * @return true 如果没有可读数据
+   */
+  bool empty() const noexcept { return available() == 0; }
+
+  /**
+   * @brief 清空缓冲区
+   */
+  void clear() noexcept { head_ = tail_ = 0; }
+
+  /**
+   * @brief 获取缓冲区总容量
+   * @return 实际映射的容量（运行期确定，映射失败时为 0）
+   */
+  size_t size() const noexcept { return capacity_; }
+
+  /**
+   * @brief 窥视缓冲区数据（不丢弃）
+   *
+   * @param data 目标缓冲区指针
+   * @param offset 相对于可用数据的偏移量
+   * @param length 要读取的字节数
+   * @return true 如果成功读取
+   * @return false 如果请求超出可用范围
+   */
+  bool peek(uint8_t *data, size_t offset, size_t length) const noexcept {
+    auto [s1, s2] = get_read_spans(offset, length);
+    if (s1.size() != length)
+      return false;
+    if (length > 0)
+      std::memcpy(data, s1.data(), length);
+    return true;
+  }
+
+  /**
+   * @brief 读取并丢弃数据
+   *
+   * @param data 目标缓冲区指针
+   * @param length 要读取的字节数
+   * @return true 如果成功读取并丢弃
+   * @return false 如果请求超出可用范围
+   */
+  bool read(uint8_t *data, size_t length) noexcept {
+    if (!peek(data, 0, length))
+      return false;
+    discard(length);
+    return true;
+  }
+};
+
+/**
+ * @brief Parser 缓冲区策略：虚拟内存镜像环形缓冲区
+ *
+ * 可读数据始终连续，Parser 据此在编译期移除所有回绕处理分支。
+ */
+struct MirroredBufferPolicy {
+  template <size_t SIZE> using buffer_type = MirroredBuffer<SIZE>;
+  static constexpr bool parse_on_write = true;  ///< 写入后立即解析
+  static constexpr bool contiguous_reads = true; ///< 帧数据始终连续
+};
+
+} // namespace RPL::Containers
+
+#endif // RPL_MIRRORED_BUFFER_HPP
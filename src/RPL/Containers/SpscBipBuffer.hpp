@@ -0,0 +1,341 @@
+/**
+ * @file SpscBipBuffer.hpp
+ * @brief RPL 单生产者单消费者 (SPSC) 无锁双区缓冲区实现
+ *
+ * 与 BipBuffer 提供相同的读写接口，但读写索引分别由生产者与消费者独占，
+ * 通过原子变量同步，允许写入端 (DMA / 串口中断) 与解析端 (工作线程)
+ * 运行在不同的上下文中，中断中只需提交字节数，不再执行解析。
+ *
+ * @par 设计原理
+ * - write_: 写入位置，仅由生产者修改
+ * - read_: 读取位置，仅由消费者修改
+ * - watermark_: 生产者回绕到缓冲区起始处时记录的有效数据末尾，仅由生产者修改
+ * - 回绕状态 (read_ > write_) 下写入端与读取位置之间保留 1 字节间隔，
+ *   以区分"空"与"满"
+ * - 可读数据依旧至多分为 [read_, watermark_) 与 [0, write_) 两段，
+ *   因此 Parser 的分段 CRC 与分段拷贝逻辑无需修改
+ *
+ * @par 线程约束
+ * - 生产者: get_write_buffer() / advance_write_index() / write() / space() / full()
+ * - 消费者: get_contiguous_read_buffer() / get_read_spans() / peek() / read()
+ *   / discard() / available() / empty() / clear()
+ *
+ * @code
+ * // 中断上下文（生产者）
+ * auto span = buffer.get_write_buffer();
+ * // DMA 写入...
+ * buffer.advance_write_index(received_bytes);
+ *
+ * // 工作线程（消费者）
+ * auto [s1, s2] = buffer.get_read_spans(0, buffer.available());
+ * // 处理数据...
+ * buffer.discard(processed_bytes);
+ * @endcode
+ */
+
+#ifndef RPL_SPSC_BIPBUFFER_HPP
+#define RPL_SPSC_BIPBUFFER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
+
+namespace RPL::Containers {
+
+/**
+ * @brief SPSC 无锁双区缓冲区类
+ *
+ * @tparam SIZE 缓冲区大小，必须是 2 的幂
+ */
+template <size_t SIZE> class SpscBipBuffer {
+  static_assert((SIZE & (SIZE - 1)) == 0, "SIZE must be a power of 2");
+  static_assert(std::atomic<size_t>::is_always_lock_free,
+                "SpscBipBuffer requires lock-free size_t atomics");
+
+  alignas(64) uint8_t buffer[SIZE]{};
+
+  // 生产者独占
+  alignas(64) std::atomic<size_t> write_{0};
+  std::atomic<size_t> watermark_{SIZE};
+  size_t grant_start_{0}; ///< 最近一次 get_write_buffer() 返回区域的起始位置
+  size_t grant_size_{0};  ///< 最近一次 get_write_buffer() 返回区域的长度
+
+  // 消费者独占
+  alignas(64) std::atomic<size_t> read_{0};
+
+  /**
+   * @brief 消费者视角的两段可读区域
+   * @return {第一段起始, 第一段长度, 第二段长度}，第二段始终从 0 开始
+   */
+  struct ReadRegions {
+    size_t start;
+    size_t first;
+    size_t second;
+  };
+
+  ReadRegions read_regions() const noexcept {
+    size_t r = read_.load(std::memory_order_relaxed);
+    const size_t w = write_.load(std::memory_order_acquire);
+    if (r <= w)
+      return {r, w - r, 0};
+    const size_t last = watermark_.load(std::memory_order_acquire);
+    if (r == last) // 第一段已读完，数据全部位于起始处
+      return {0, w, 0};
+    return {r, last - r, w};
+  }
+
+public:
+  /**
+   * @brief 获取连续缓冲区用于写入（生产者）
+   *
+   * 返回可用于写入的最大连续块。尾部无空间时切换到缓冲区起始处。
+   *
+   * @return 可写入的连续内存 span，如果缓冲区已满则返回空 span
+   * @note 此方法支持零拷贝 DMA 写入
+   */
+  std::span<uint8_t> get_write_buffer() noexcept {
+    const size_t w = write_.load(std::memory_order_relaxed);
+    const size_t r = read_.load(std::memory_order_acquire);
+
+    if (w < r) {
+      // 已回绕：只能写到读取位置之前（保留 1 字节间隔）
+      grant_start_ = w;
+      grant_size_ = r - w - 1;
+    } else if (w < SIZE) {
+      grant_start_ = w;
+      grant_size_ = SIZE - w;
+    } else {
+      // 尾部已满，尝试回绕到起始处
+      grant_start_ = 0;
+      grant_size_ = r > 0 ? r - 1 : 0;
+    }
+    return {buffer + grant_start_, grant_size_};
+  }
+
+  /**
+   * @brief 提交写入（生产者）
+   *
+   * 提交最近一次 get_write_buffer() 返回区域中已写入的字节数。
+   *
+   * @param length 已写入的字节数
+   * @return true 如果成功提交
+   * @return false 如果提交长度超出返回区域
+   */
+  bool advance_write_index(size_t length) noexcept {
+    if (length == 0)
+      return true;
+    if (length > grant_size_)
+      return false;
+
+    const size_t w = write_.load(std::memory_order_relaxed);
+    if (grant_start_ != w) {
+      // 回绕：先发布旧数据的末尾，再发布新的写入位置
+      watermark_.store(w, std::memory_order_relaxed);
+    }
+    grant_start_ += length;
+    grant_size_ -= length;
+    write_.store(grant_start_, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief 复制数据到缓冲区（生产者）
+   *
+   * 如果尾部连续空间不足但起始处足够，会提前回绕。
+   *
+   * @param data 指向源数据的指针
+   * @param length 要写入的字节数
+   * @return true 如果成功写入
+   * @return false 如果没有足够的连续空间
+   */
+  bool write(const uint8_t *data, size_t length) noexcept {
+    if (length == 0)
+      return true;
+
+    auto span = get_write_buffer();
+    if (span.size() < length) {
+      const size_t w = write_.load(std::memory_order_relaxed);
+      const size_t r = read_.load(std::memory_order_acquire);
+      // 仅在未回绕时可以提前切换到起始处
+      if (w < r || r == 0 || r - 1 < length)
+        return false;
+      grant_start_ = 0;
+      grant_size_ = r - 1;
+      span = {buffer, grant_size_};
+    }
+    std::memcpy(span.data(), data, length);
+    return advance_write_index(length);
+  }
+
+  /**
+   * @brief 获取连续数据用于读取（消费者）
+   *
+   * @return 第一段可读的连续内存 span，如果没有数据则返回空 span
+   */
+  [[nodiscard]] std::span<const uint8_t>
+  get_contiguous_read_buffer() const noexcept {
+    const auto regions = read_regions();
+    if (regions.first > 0)
+      return {buffer + regions.start, regions.first};
+    return {};
+  }
+
+  /**
+   * @brief 丢弃数据（消费者）
+   *
+   * @param length 要丢弃的字节数
+   * @return true 如果成功丢弃
+   * @return false 如果请求长度超过可用数据量
+   */
+  bool discard(size_t length) noexcept {
+    if (length == 0)
+      return true;
+    const auto regions = read_regions();
+    if (length > regions.first + regions.second)
+      return false;
+
+    size_t r = regions.start + length;
+    if (length >= regions.first && regions.second > 0)
+      r = length - regions.first;
+    read_.store(r, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief 获取两个连续的读视图（消费者）
+   *
+   * @param offset 相对于可用数据的偏移量
+   * @param length 要读取的长度
+   * @return std::pair 包含两个 span。如果数据是连续的，第二个 span 为空。
+   *         如果请求超出范围，两个 span 都为空。
+   */
+  [[nodiscard]] std::pair<std::span<const uint8_t>, std::span<const uint8_t>>
+  get_read_spans(size_t offset, size_t length) const noexcept {
+    const auto regions = read_regions();
+    if (offset + length > regions.first + regions.second)
+      return {{}, {}};
+
+    if (offset < regions.first) {
+      const size_t first_readable = regions.first - offset;
+      if (length <= first_readable)
+        return {{buffer + regions.start + offset, length}, {}};
+      return {{buffer + regions.start + offset, first_readable},
+              {buffer, length - first_readable}};
+    }
+    return {{buffer + (offset - regions.first), length}, {}};
+  }
+
+  /**
+   * @brief 获取可用数据字节数（消费者）
+   * @return 当前缓冲区中可读数据的总字节数
+   */
+  size_t available() const noexcept {
+    const auto regions = read_regions();
+    return regions.first + regions.second;
+  }
+
+  /**
+   * @brief 获取可用写入空间（生产者）
+   *
+   * 注意：这是总空闲字节数，不一定是连续的。
+   *
+   * @return 总空闲字节数
+   */
+  size_t space() const noexcept {
+    const size_t w = write_.load(std::memory_order_relaxed);
+    const size_t r = read_.load(std::memory_order_acquire);
+    if (w < r)
+      return r - w - 1;
+    return (SIZE - w) + (r > 0 ? r - 1 : 0);
+  }
+
+  /**
+   * @brief 检查缓冲区是否已满（生产者）
+   * @return true 如果没有可用写入空间
+   */
+  bool full() const noexcept { return space() == 0; }
+
+  /**
+   * @brief 检查缓冲区是否为空（消费者）
+   * @return true 如果没有可读数据
+   */
+  bool empty() const noexcept { return available() == 0; }
+
+  /**
+   * @brief 清空缓冲区（消费者）
+   *
+   * 丢弃当前所有可读数据。与生产者并发调用是安全的，
+   * 清空过程中新提交的数据可能被保留。
+   */
+  void clear() noexcept { discard(available()); }
+
+  /**
+   * @brief 获取缓冲区总容量
+   * @return 缓冲区的总大小（编译期常量）
+   */
+  static constexpr size_t size() { return SIZE; }
+
+  /**
+   * @brief 窥视缓冲区数据（消费者，不丢弃）
+   *
+   * @param data 目标缓冲区指针
+   * @param offset 相对于可用数据的偏移量
+   * @param length 要读取的字节数
+   * @return true 如果成功读取
+   * @return false 如果请求超出可用范围
+   */
+  bool peek(uint8_t *data, size_t offset, size_t length) const noexcept {
+    auto [s1, s2] = get_read_spans(offset, length);
+    if (s1.size() + s2.size() != length)
+      return false;
+    if (!s1.empty())
+      std::memcpy(data, s1.data(), s1.size());
+    if (!s2.empty())
+      std::memcpy(data + s1.size(), s2.data(), s2.size());
+    return true;
+  }
+
+  /**
+   * @brief 读取并丢弃数据（消费者）
+   *
+   * @param data 目标缓冲区指针
+   * @param length 要读取的字节数
+   * @return true 如果成功读取并丢弃
+   * @return false 如果请求超出可用范围
+   */
+  bool read(uint8_t *data, size_t length) noexcept {
+    if (!peek(data, 0, length))
+      return false;
+    discard(length);
+    return true;
+  }
+};
+
+/**
+ * @brief Parser 缓冲区策略：SPSC 无锁双区缓冲区
+ *
+ * 使用此策略时，Parser::push_data() / advance_write_index() 只提交数据，
+ * 不执行解析；由消费者线程调用 Parser::try_parse_packets() 完成解析。
+ *
+ * @code
+ * RPL::Parser<RPL::Containers::SpscBipBufferPolicy, PacketA, PacketB> parser{des};
+ *
+ * // UART 中断 / DMA 完成回调
+ * parser.advance_write_index(received_len);
+ *
+ * // 工作线程
+ * parser.try_parse_packets();
+ * @endcode
+ */
+struct SpscBipBufferPolicy {
+  template <size_t SIZE> using buffer_type = SpscBipBuffer<SIZE>;
+  static constexpr bool parse_on_write = false; ///< 写入端不执行解析
+};
+
+} // namespace RPL::Containers
+
+#endif // RPL_SPSC_BIPBUFFER_HPP
@@ -11,15 +11,21 @@
 #ifndef RPL_DESERIALIZER_HPP
 #define RPL_DESERIALIZER_HPP
 
+#include "Containers/HistoryRing.hpp"
 #include "Containers/MemoryPool.hpp"
 #include "Meta/BitstreamParser.hpp"
 #include "Meta/PacketInfoCollector.hpp"
+#include "Meta/PacketSet.hpp"
+#include "PacketView.hpp"
 #include "Utils/CompilerBarrier.hpp"
 #ifdef RPL_USE_STD_ATOMIC
 #include <atomic>
 #endif
+#include <algorithm>
 #include <cstring>
+#include <optional>
 #include <span>
+#include <tuple>
 
 /**
  * @namespace RPL
@@ -40,6 +46,16 @@ namespace RPL {
 template <typename T, typename... Ts>
 concept Deserializable = (std::is_same_v<T, Ts> || ...);
 
+/**
+ * @brief 历史队列中的一条记录
+ *
+ * @tparam T 数据包类型
+ */
+template <typename T> struct HistoryEntry {
+  uint32_t seq; ///< 该类型的接收序号（从 0 递增，含因队列满被丢弃的记录）
+  T packet;     ///< 数据包内容
+};
+
 /**
  * @brief 反序列化器类
  *
@@ -52,6 +68,12 @@ concept Deserializable = (std::is_same_v<T, Ts> || ...);
  * - 使用静态内存池避免动态分配
  * - SeqLock 机制保证读取一致性
  * - 支持分段写入（用于 BipBuffer 边界跨越场景）
+ * - PacketTraits::history_depth > 0 的事件型数据包额外保留 SPSC 历史队列，
+ *   通过 pop_history() 逐条取出
+ * - 定义 RPL_CACHE_LINE_ISOLATION 时，每个数据包的 version 与数据槽位
+ *   各自按缓存行对齐，消除多核读者之间的伪共享
+ * - PacketTraits::decode_on_write 为 true 的 BitLayout 数据包在写入时解码，
+ *   get() 只做 SeqLock 保护下的拷贝
  *
  * @par 使用示例
  * @code
@@ -68,13 +90,277 @@ template <typename... Ts> class Deserializer {
   using Collector = Meta::PacketInfoCollector<Ts...>; ///< 用于收集包信息的类型
   Containers::MemoryPool<Collector> pool{}; ///< 存储反序列化数据的内存池
 
+  /**
+   * @brief SeqLock version 计数器单元
+   *
+   * 定义 RPL_CACHE_LINE_ISOLATION 时每个单元独占一个缓存行，
+   * 写入某个数据包不会使其他数据包读者正在轮询的缓存行失效；
+   * 否则与普通 uint32_t 数组布局相同。
+   */
+  template <typename V>
+  struct alignas(std::max(SLOT_ALIGNMENT, alignof(V))) VersionCell {
+    V value{};
+  };
+
 #ifdef RPL_USE_STD_ATOMIC
   /// @brief SeqLock version counters（原子版本）
-  std::atomic<uint32_t> versions_[sizeof...(Ts)]{};
+  VersionCell<std::atomic<uint32_t>> versions_[sizeof...(Ts)]{};
 #else
   /// @brief SeqLock version counters（volatile + compiler barrier 版本）
-  volatile uint32_t versions_[sizeof...(Ts)]{};
+  VersionCell<volatile uint32_t> versions_[sizeof...(Ts)]{};
+#endif
+
+  /// @brief 未声明 history_depth 的类型占位（按索引区分的空类型，不占用存储）
+  template <size_t I> struct NoHistory {};
+
+  template <typename T, size_t I>
+  using HistoryFor = std::conditional_t<
+      (Meta::history_depth_v<Meta::PacketTraits<T>> > 0),
+      Containers::HistoryRing<Meta::PacketTraits<T>::size,
+                              Meta::history_depth_v<Meta::PacketTraits<T>>>,
+      NoHistory<I>>;
+
+  template <typename Seq> struct HistoryTuple;
+  template <size_t... Is> struct HistoryTuple<std::index_sequence<Is...>> {
+    using type = std::tuple<HistoryFor<Ts, Is>...>;
+  };
+
+  /// @brief 按序列索引排列的历史队列
+  [[no_unique_address]] typename HistoryTuple<
+      std::index_sequence_for<Ts...>>::type histories_{};
+
+  /// @brief 是否有任何数据包声明了历史队列
+  static constexpr bool any_history =
+      ((Meta::history_depth_v<Meta::PacketTraits<Ts>> > 0) || ...);
+
+#ifdef RPL_USE_STD_ATOMIC
+  /// @brief 每个数据包类型的长度不匹配计数（原子版本）
+  std::atomic<uint32_t> length_errors_[sizeof...(Ts)]{};
+#else
+  /// @brief 每个数据包类型的长度不匹配计数
+  volatile uint32_t length_errors_[sizeof...(Ts)]{};
+#endif
+
+  /**
+   * @brief 按 LengthPolicy 校验并裁剪待写入的数据长度
+   *
+   * 在触碰内存池之前执行，保证写入长度永远不超过槽位大小。
+   *
+   * @param entry 命令表项
+   * @param len 帧中携带的数据长度（会被裁剪为实际拷贝长度）
+   * @return true 如果允许写入
+   */
+  bool check_length(const Meta::CmdEntry &entry, size_t &len) noexcept {
+    if (len == entry.size) [[likely]]
+      return true;
+
+#ifdef RPL_USE_STD_ATOMIC
+    length_errors_[entry.seq].fetch_add(1, std::memory_order_relaxed);
+#else
+    length_errors_[entry.seq] = length_errors_[entry.seq] + 1;
+#endif
+
+    if (entry.policy == Meta::LengthPolicy::Reject)
+      return false;
+    len = std::min<size_t>(len, entry.size);
+    return true;
+  }
+
+  /// @brief SeqLock 写入开始（version 变为奇数）
+  void begin_write(size_t seq_idx) noexcept {
+#ifdef RPL_USE_STD_ATOMIC
+    versions_[seq_idx].value.fetch_add(1, std::memory_order_release);
+#else
+    versions_[seq_idx].value = versions_[seq_idx].value + 1;
+    compiler_barrier();
+#endif
+  }
+
+  /// @brief SeqLock 写入结束（version 变为偶数）
+  void end_write(size_t seq_idx) noexcept {
+#ifdef RPL_USE_STD_ATOMIC
+    versions_[seq_idx].value.fetch_add(1, std::memory_order_release);
+#else
+    compiler_barrier();
+    versions_[seq_idx].value = versions_[seq_idx].value + 1;
+#endif
+  }
+
+  /// @brief 写入时解码函数类型，s1/s2 已按 LengthPolicy 裁剪
+  using Decoder = void (*)(Deserializer &, const Meta::CmdEntry &,
+                           std::span<const uint8_t>, std::span<const uint8_t>);
+
+  /// @brief 是否有任何数据包启用了 decode_on_write
+  static constexpr bool any_decode_on_write =
+      (Meta::DecodesOnWrite<Meta::PacketTraits<Ts>> || ...);
+
+  /**
+   * @brief 写入时解码：拼接原始字节、解码为 T，再在 SeqLock 保护下存入槽位
+   *
+   * 解码在临界区之外完成，写入端持有奇数 version 的时间只有一次 T 的拷贝。
+   */
+  template <typename T>
+  static void decode_write(Deserializer &self, const Meta::CmdEntry &entry,
+                           std::span<const uint8_t> s1,
+                           std::span<const uint8_t> s2) noexcept {
+    using Traits = Meta::PacketTraits<T>;
+    uint8_t raw[Traits::size]{};
+    if (!s1.empty())
+      std::memcpy(raw, s1.data(), s1.size());
+    if (!s2.empty())
+      std::memcpy(raw + s1.size(), s2.data(), s2.size());
+    Traits::before_get(raw);
+    const T decoded =
+        deserialize_bitstream<T>(std::span<const uint8_t>(raw, Traits::size));
+
+    self.begin_write(entry.seq);
+    std::memcpy(&self.pool.buffer[entry.offset], &decoded, sizeof(T));
+    self.end_write(entry.seq);
+  }
+
+  /// @brief 历史队列入队函数类型，s1/s2 已按 LengthPolicy 裁剪
+  using HistoryPusher = void (*)(Deserializer &, std::span<const uint8_t>,
+                                 std::span<const uint8_t>);
+
+  template <size_t I>
+  static void push_history(Deserializer &self, std::span<const uint8_t> s1,
+                           std::span<const uint8_t> s2) noexcept {
+    std::get<I>(self.histories_).push(s1, s2);
+  }
+
+  /**
+   * @brief 获取序列索引对应的历史队列入队函数
+   * @return 入队函数，未声明 history_depth 的数据包返回 nullptr
+   */
+  static constexpr HistoryPusher history_pusher(size_t seq_idx) noexcept {
+    constexpr auto table = []<size_t... Is>(std::index_sequence<Is...>) {
+      return std::array<HistoryPusher, sizeof...(Ts)>{[]() -> HistoryPusher {
+        if constexpr (!std::is_same_v<
+                          std::tuple_element_t<Is, decltype(histories_)>,
+                          NoHistory<Is>>)
+          return &push_history<Is>;
+        else
+          return nullptr;
+      }()...};
+    }(std::index_sequence_for<Ts...>{});
+    return table[seq_idx];
+  }
+
+  /**
+   * @brief 获取序列索引对应的写入时解码函数
+   * @return 解码函数，未启用 decode_on_write 的数据包返回 nullptr
+   */
+  static constexpr Decoder decoder(size_t seq_idx) noexcept {
+    constexpr Decoder table[sizeof...(Ts)] = {[]() -> Decoder {
+      if constexpr (Meta::DecodesOnWrite<Meta::PacketTraits<Ts>>)
+        return &decode_write<Ts>;
+      else
+        return nullptr;
+    }()...};
+    return table[seq_idx];
+  }
+
+  /// @brief 读取指定序列索引的当前 version
+  uint32_t load_version(size_t seq_idx) const noexcept {
+#ifdef RPL_USE_STD_ATOMIC
+    return versions_[seq_idx].value.load(std::memory_order_acquire);
+#else
+    const uint32_t v = versions_[seq_idx].value;
+    compiler_barrier();
+    return v;
 #endif
+  }
+
+  /**
+   * @brief SeqLock 读循环
+   *
+   * @tparam T 数据包类型
+   * @param version 输出本次读取对应的（偶数）version
+   * @return 一致的数据包副本
+   */
+  template <typename T> T read_consistent(uint32_t &version) noexcept {
+    constexpr auto seq_idx = Collector::template type_seq_index<T>();
+    T result;
+    uint32_t v1, v2;
+    do {
+      v1 = load_version(seq_idx);
+
+      auto ptr = reinterpret_cast<uint8_t *>(
+          &pool.buffer[Collector::template type_index<T>()]);
+      if constexpr (Meta::DecodesOnWrite<Meta::PacketTraits<T>>) {
+        // 写入时已解码并执行过 before_get，直接拷贝
+        result = *reinterpret_cast<const T *>(ptr);
+      } else if constexpr (Meta::HasBitLayout<Meta::PacketTraits<T>>) {
+        Meta::PacketTraits<T>::before_get(ptr);
+        result = deserialize_bitstream<T>(
+            std::span<const uint8_t>(ptr, Meta::PacketTraits<T>::size));
+      } else {
+        Meta::PacketTraits<T>::before_get(ptr);
+        result = *reinterpret_cast<const T *>(ptr);
+      }
+
+#ifdef RPL_USE_STD_ATOMIC
+      std::atomic_thread_fence(std::memory_order_acquire);
+      v2 = versions_[seq_idx].value.load(std::memory_order_relaxed);
+#else
+      compiler_barrier();
+      v2 = versions_[seq_idx].value;
+#endif
+    } while (v1 != v2 || (v1 & 1));
+    version = v1;
+    return result;
+  }
+
+  /**
+   * @brief 按命令表项写入一帧数据
+   *
+   * 依次执行长度校验、历史队列入队、写入时解码或 SeqLock 拷贝。
+   *
+   * @param entry 命令表项
+   * @param s1 第一段数据（可能为空）
+   * @param s2 第二段数据（可能为空）
+   * @return true 如果数据已写入内存池
+   */
+  bool write_entry(const Meta::CmdEntry &entry, std::span<const uint8_t> s1,
+                   std::span<const uint8_t> s2) noexcept {
+    size_t len = s1.size() + s2.size();
+    if (!check_length(entry, len))
+      return false;
+    const size_t seq_idx = entry.seq;
+    const size_t expected = entry.size;
+    if (s1.size() >= len) {
+      s1 = s1.first(len);
+      s2 = {};
+    } else {
+      s2 = s2.first(len - s1.size());
+    }
+
+    if constexpr (any_history) {
+      if (const auto push = history_pusher(seq_idx))
+        push(*this, s1, s2);
+    }
+
+    if constexpr (any_decode_on_write) {
+      if (const auto decode = decoder(seq_idx)) {
+        decode(*this, entry, s1, s2);
+        return true;
+      }
+    }
+
+    begin_write(seq_idx);
+    uint8_t *dest = reinterpret_cast<uint8_t *>(&pool.buffer[entry.offset]);
+    if (!s1.empty()) {
+      std::memcpy(dest, s1.data(), s1.size());
+    }
+    if (!s2.empty()) {
+      std::memcpy(dest + s1.size(), s2.data(), s2.size());
+    }
+    if (len < expected) {
+      std::memset(dest + len, 0, expected - len);
+    }
+    end_write(seq_idx);
+    return true;
+  }
 
 public:
   /**
@@ -92,29 +378,12 @@ public:
    * @param cmd 命令码
    * @param src 数据源指针
    * @param len 数据长度
+   * @return true 如果数据已写入内存池；命令码未注册或长度被拒绝时返回 false
+   *
+   * @note 长度与 PacketTraits::size 不一致时按 PacketTraits::length_policy 处理
    */
-  void write(uint16_t cmd, const uint8_t *src, size_t len) noexcept {
-    const auto byte_offset = Collector::cmd_index(cmd);
-    if (byte_offset == static_cast<size_t>(-1))
-      return;
-    const auto seq_idx = Collector::cmd_seq_index(cmd);
-
-#ifdef RPL_USE_STD_ATOMIC
-    versions_[seq_idx].fetch_add(1, std::memory_order_release);
-#else
-    versions_[seq_idx] = versions_[seq_idx] + 1;
-    compiler_barrier();
-#endif
-
-    std::memcpy(reinterpret_cast<uint8_t *>(&pool.buffer[byte_offset]), src,
-                len);
-
-#ifdef RPL_USE_STD_ATOMIC
-    versions_[seq_idx].fetch_add(1, std::memory_order_release);
-#else
-    compiler_barrier();
-    versions_[seq_idx] = versions_[seq_idx] + 1;
-#endif
+  bool write(uint16_t cmd, const uint8_t *src, size_t len) noexcept {
+    return write_segmented(cmd, {src, len}, {});
   }
 
   /**
@@ -126,37 +395,54 @@ public:
    * @param cmd 命令码
    * @param s1 第一段数据（可能为空）
    * @param s2 第二段数据（可能为空）
+   * @return true 如果数据已写入内存池（父数据包或子数据包任一写入即为 true）；
+   *         命令码未注册或长度被拒绝时返回 false
    *
    * @note 此方法用于零拷贝场景，直接从 BipBuffer 的分段视图写入
+   * @note 长度与 PacketTraits::size 不一致时按 PacketTraits::length_policy 处理
+   * @note 注册了子数据包时，父命令码的负载还会按子命令码二级分发
    */
-  void write_segmented(uint16_t cmd, std::span<const uint8_t> s1,
+  bool write_segmented(uint16_t cmd, std::span<const uint8_t> s1,
                        std::span<const uint8_t> s2) noexcept {
-    const auto byte_offset = Collector::cmd_index(cmd);
-    if (byte_offset == static_cast<size_t>(-1))
-      return;
-    const auto seq_idx = Collector::cmd_seq_index(cmd);
+    return static_cast<bool>(write_entries(cmd, s1, s2));
+  }
 
-#ifdef RPL_USE_STD_ATOMIC
-    versions_[seq_idx].fetch_add(1, std::memory_order_release);
-#else
-    versions_[seq_idx] = versions_[seq_idx] + 1;
-    compiler_barrier();
-#endif
+  /// @brief write_entries() 的结果：实际写入内存池的表项
+  struct WrittenEntries {
+    const Meta::CmdEntry *parent = nullptr; ///< 父命令码表项，未写入为 nullptr
+    const Meta::CmdEntry *sub = nullptr;    ///< 子数据包表项，未写入为 nullptr
+    std::span<const uint8_t> sub_s1;        ///< 子数据包内容第一段
+    std::span<const uint8_t> sub_s2;        ///< 子数据包内容第二段
 
-    uint8_t *dest = reinterpret_cast<uint8_t *>(&pool.buffer[byte_offset]);
-    if (!s1.empty()) {
-      std::memcpy(dest, s1.data(), s1.size());
-    }
-    if (!s2.empty()) {
-      std::memcpy(dest + s1.size(), s2.data(), s2.size());
-    }
+    explicit operator bool() const noexcept { return parent || sub; }
+  };
 
-#ifdef RPL_USE_STD_ATOMIC
-    versions_[seq_idx].fetch_add(1, std::memory_order_release);
-#else
-    compiler_barrier();
-    versions_[seq_idx] = versions_[seq_idx] + 1;
-#endif
+  /**
+   * @brief 分段写入并分别报告父、子数据包的写入结果
+   *
+   * 与 write_segmented() 相同，但父数据包与子数据包各自的长度校验结果
+   * 分开返回，Parser 据此只分发真正写入的表项。
+   *
+   * @param cmd 命令码
+   * @param s1 第一段数据（可能为空）
+   * @param s2 第二段数据（可能为空）
+   * @return 写入成功的表项；子数据包还带有去掉子帧头后的内容视图
+   */
+  WrittenEntries write_entries(uint16_t cmd, std::span<const uint8_t> s1,
+                               std::span<const uint8_t> s2) noexcept {
+    WrittenEntries written;
+    if (const auto *entry = Collector::cmd_entry(cmd);
+        entry && write_entry(*entry, s1, s2))
+      written.parent = entry;
+    if constexpr (Collector::has_sub_packets) {
+      if (const auto *sub = Collector::resolve_sub_packet(cmd, s1, s2);
+          sub && write_entry(*sub, s1, s2)) {
+        written.sub = sub;
+        written.sub_s1 = s1;
+        written.sub_s2 = s2;
+      }
+    }
+    return written;
   }
 
   /**
@@ -180,37 +466,175 @@ public:
   template <typename T>
     requires Deserializable<T, Ts...>
   T get() noexcept {
+    uint32_t version;
+    return read_consistent<T>(version);
+  }
+
+  /**
+   * @brief 消费者游标
+   *
+   * 记录某个消费者上一次取得的每个数据包类型的 version，
+   * 多个任务各自持有一个 Cursor 即可独立跟踪数据是否更新。
+   *
+   * @par 使用示例
+   * @code
+   * RPL::Deserializer<RobotStatus, GameStatus>::Cursor cursor;
+   *
+   * // 控制循环
+   * if (auto status = deserializer.try_get_new<RobotStatus>(cursor)) {
+   *     // 仅在收到新的 RobotStatus 后执行
+   * }
+   * @endcode
+   */
+  class Cursor {
+    uint32_t seen_[sizeof...(Ts)]{};
+    friend class Deserializer;
+  };
+
+private:
+  /// @brief 内置游标，供不传入 Cursor 的 has_new() / try_get_new() 使用
+  Cursor default_cursor_{};
+
+public:
+
+  /**
+   * @brief 检查指定类型自该游标上次消费后是否有新数据
+   *
+   * 只读取一次 version，不拷贝数据。写入进行中也视为有新数据。
+   *
+   * @tparam T 数据包类型
+   * @param cursor 消费者游标
+   * @return true 如果有尚未消费的新数据
+   */
+  template <typename T>
+    requires Deserializable<T, Ts...>
+  bool has_new(const Cursor &cursor) const noexcept {
     constexpr auto seq_idx = Collector::template type_seq_index<T>();
-    T result;
-    uint32_t v1, v2;
-    do {
-#ifdef RPL_USE_STD_ATOMIC
-      v1 = versions_[seq_idx].load(std::memory_order_acquire);
-#else
-      v1 = versions_[seq_idx];
-      compiler_barrier();
-#endif
+    return load_version(seq_idx) != cursor.seen_[seq_idx];
+  }
 
-      auto ptr = reinterpret_cast<uint8_t *>(
-          &pool.buffer[Collector::template type_index<T>()]);
-      Meta::PacketTraits<T>::before_get(ptr);
-      if constexpr (Meta::HasBitLayout<Meta::PacketTraits<T>>) {
-        result = deserialize_bitstream<T>(
-            std::span<const uint8_t>(ptr, Meta::PacketTraits<T>::size));
-      } else {
-        result = *reinterpret_cast<const T *>(ptr);
-      }
+  /**
+   * @brief 使用内置游标检查是否有新数据（单消费者场景）
+   * @tparam T 数据包类型
+   * @return true 如果有尚未通过 try_get_new<T>() 消费的新数据
+   */
+  template <typename T>
+    requires Deserializable<T, Ts...>
+  bool has_new() const noexcept {
+    return has_new<T>(default_cursor_);
+  }
 
+  /**
+   * @brief 仅在有新数据时获取指定类型的数据包
+   *
+   * 有新数据时执行与 get() 相同的 SeqLock 读循环，并把游标推进到
+   * 本次读到的 version；没有新数据时只读取一次 version 即返回。
+   *
+   * @tparam T 数据包类型
+   * @param cursor 消费者游标
+   * @return 新数据包；自上次消费后没有新数据时返回 std::nullopt
+   *
+   * @note 两次消费之间的多次更新只会返回最新一次
+   */
+  template <typename T>
+    requires Deserializable<T, Ts...>
+  std::optional<T> try_get_new(Cursor &cursor) noexcept {
+    constexpr auto seq_idx = Collector::template type_seq_index<T>();
+    if (load_version(seq_idx) == cursor.seen_[seq_idx])
+      return std::nullopt;
+    uint32_t version;
+    T result = read_consistent<T>(version);
+    cursor.seen_[seq_idx] = version;
+    return result;
+  }
+
+  /**
+   * @brief 使用内置游标获取新数据（单消费者场景）
+   * @tparam T 数据包类型
+   * @return 新数据包；自上次消费后没有新数据时返回 std::nullopt
+   */
+  template <typename T>
+    requires Deserializable<T, Ts...>
+  std::optional<T> try_get_new() noexcept {
+    return try_get_new<T>(default_cursor_);
+  }
+
+  /**
+   * @brief 取出指定类型历史队列中最早的一条记录
+   *
+   * 仅适用于 PacketTraits::history_depth > 0 的数据包。每条通过校验的帧
+   * 都会入队，直到被取走；与 get() 的最新值语义互不影响。
+   *
+   * @tparam T 数据包类型
+   * @return 最早的一条记录；队列为空时返回 std::nullopt
+   *
+   * @note 单消费者：同一类型的 pop_history() 只能在一个上下文中调用
+   *
+   * @par 使用示例
+   * @code
+   * while (auto shot = deserializer.pop_history<ShootData>()) {
+   *     handle_shot(shot->seq, shot->packet);
+   * }
+   * @endcode
+   */
+  template <typename T>
+    requires(Deserializable<T, Ts...> &&
+             Meta::history_depth_v<Meta::PacketTraits<T>> > 0)
+  std::optional<HistoryEntry<T>> pop_history() noexcept {
+    constexpr auto seq_idx = Collector::template type_seq_index<T>();
+    uint8_t raw[Meta::PacketTraits<T>::size];
+    uint32_t seq;
+    if (!std::get<seq_idx>(histories_).pop(seq, raw))
+      return std::nullopt;
+    return HistoryEntry<T>{
+        seq, PacketView<T>{std::span<const uint8_t>(raw), {}}.get()};
+  }
+
+  /**
+   * @brief 获取指定类型历史队列中尚未取走的记录数
+   * @tparam T 数据包类型
+   * @return 可读记录数
+   */
+  template <typename T>
+    requires(Deserializable<T, Ts...> &&
+             Meta::history_depth_v<Meta::PacketTraits<T>> > 0)
+  size_t history_available() const noexcept {
+    constexpr auto seq_idx = Collector::template type_seq_index<T>();
+    return std::get<seq_idx>(histories_).available();
+  }
+
+  /**
+   * @brief 获取指定类型因历史队列已满而丢弃的记录数
+   * @tparam T 数据包类型
+   * @return 丢弃的累计次数
+   */
+  template <typename T>
+    requires(Deserializable<T, Ts...> &&
+             Meta::history_depth_v<Meta::PacketTraits<T>> > 0)
+  uint32_t get_history_overflow_count() const noexcept {
+    constexpr auto seq_idx = Collector::template type_seq_index<T>();
+    return std::get<seq_idx>(histories_).overflow_count();
+  }
+
+  /**
+   * @brief 获取指定类型的长度不匹配计数
+   *
+   * 每收到一个 CRC 校验通过、但数据长度与 PacketTraits::size 不一致的帧，
+   * 计数加一（无论该帧最终被丢弃还是截断/补零后写入）。
+   *
+   * @tparam T 数据包类型
+   * @return 长度不匹配的累计次数
+   */
+  template <typename T>
+    requires Deserializable<T, Ts...>
+  uint32_t get_length_error_count() const noexcept {
+    constexpr auto seq_idx = Collector::template type_seq_index<T>();
 #ifdef RPL_USE_STD_ATOMIC
-      std::atomic_thread_fence(std::memory_order_acquire);
-      v2 = versions_[seq_idx].load(std::memory_order_relaxed);
+    return length_errors_[seq_idx].load(std::memory_order_relaxed);
 #else
-      compiler_barrier();
-      v2 = versions_[seq_idx];
+    return length_errors_[seq_idx];
 #endif
-    } while (v1 != v2 || (v1 & 1));
-    return result;
-  };
+  }
 
   /**
    * @brief 获取指定类型的直接引用
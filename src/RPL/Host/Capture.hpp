@@ -0,0 +1,436 @@
+/**
+ * @file Capture.hpp
+ * @brief RPL 带时间戳的二进制录制与回放 (POSIX)
+ *
+ * Writer 把 Parser 接收到的数据追加写入录制文件，Reader 通过 mmap
+ * 打开录制文件并按原始节奏（或加速）回放到 Parser 中，
+ * 用于复现现场问题以及用真实比赛流量对解析器做基准测试。
+ *
+ * @par 录制内容
+ * - Raw：原始串口字节块，经 Parser::set_raw_tap() 写入（attach_raw()），
+ *   覆盖 push_data() 与 DMA 的 get_write_buffer() / advance_write_index() 路径；
+ *   也可由 Writer::push() 送入 Parser 后写入
+ * - Dropped：Parser 缓冲区溢出而被整块丢弃的字节块，回放时跳过，
+ *   使回放与现场的丢包情况一致
+ * - Frame：通过帧 CRC 校验的完整帧及其命令码，经 Parser::set_frame_tap() 写入
+ *
+ * Raw 与 Frame 记录都保存线上的原始字节，回放时同样送入 Parser 的写入路径，
+ * 因此同一个文件只应录制其中一种。
+ *
+ * @par 文件格式（小端）
+ * @code
+ * FileHeader   16 字节  magic "RPLCAP"、version、保留字段
+ * Record...    RecordHeader (16 字节) + data (length 字节) + 补齐到 8 字节
+ * @endcode
+ * - 时间戳为相对于录制开始的单调时钟 (steady_clock) 纳秒数
+ * - 只追加写入，每条记录以一次 writev() 写出；写入不完整时截断回上一条
+ *   记录的末尾并停止录制，进程异常退出时末尾不完整的记录会被 Reader 忽略
+ * - 记录按 8 字节对齐，整个文件可直接 mmap 后按 span 遍历
+ *
+ * @code
+ * #include <RPL/Host/Capture.hpp>
+ *
+ * RPL::Capture::Writer writer;
+ * writer.open("match.rplcap");
+ * writer.attach(parser);                // 录制每个有效帧
+ * writer.attach_raw(parser);            // 或录制送入 parser 的原始字节
+ *
+ * RPL::Capture::MappedFile file("match.rplcap");
+ * RPL::Capture::Reader reader(file.data());
+ * reader.replay(parser, 4.0);           // 四倍速回放
+ * @endcode
+ */
+
+#ifndef RPL_CAPTURE_HPP
+#define RPL_CAPTURE_HPP
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "RPL::Capture requires a POSIX host (open/writev/mmap)"
+#endif
+
+#include "RPL/Utils/Error.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <span>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <thread>
+#include <tl/expected.hpp>
+#include <unistd.h>
+
+namespace RPL::Capture {
+
+static_assert(std::endian::native == std::endian::little,
+              "Capture format is little-endian");
+
+/// @brief 记录类型
+enum class RecordType : uint16_t {
+  Raw = 0,     ///< 原始字节块
+  Frame = 1,   ///< 通过校验的完整帧
+  Dropped = 2, ///< 被 Parser 拒绝（缓冲区溢出）的原始字节块，回放时跳过
+};
+
+/// @brief 文件头
+struct FileHeader {
+  char magic[6];     ///< "RPLCAP"
+  uint16_t version;  ///< 格式版本
+  uint64_t reserved; ///< 保留，写 0
+};
+
+/// @brief 记录头
+struct RecordHeader {
+  uint32_t length;  ///< 数据字节数（不含补齐）
+  RecordType type;  ///< 记录类型
+  uint16_t cmd;     ///< Frame 记录的命令码，Raw 记录为 0
+  uint64_t time_ns; ///< 相对于录制开始的单调时钟纳秒数
+};
+
+static_assert(sizeof(FileHeader) == 16 && sizeof(RecordHeader) == 16);
+
+inline constexpr char magic[6] = {'R', 'P', 'L', 'C', 'A', 'P'};
+inline constexpr uint16_t version = 1;
+inline constexpr size_t record_align = 8;
+
+/// @brief 记录在文件中占用的总字节数
+constexpr size_t record_size(size_t length) noexcept {
+  return sizeof(RecordHeader) +
+         ((length + record_align - 1) & ~(record_align - 1));
+}
+
+/**
+ * @brief 录制文件写入器
+ *
+ * 不保证线程安全：attach() 的帧回调与 push() 运行在 Parser 的解析上下文中，
+ * 应与 Parser 位于同一线程。
+ */
+class Writer {
+  using Clock = std::chrono::steady_clock;
+
+  int fd_{-1};
+  Clock::time_point origin_{};
+  uint64_t records_{0};
+  uint64_t bytes_{0};
+  bool failed_{false};
+
+  static void frame_tap(uint16_t cmd, std::span<const uint8_t> s1,
+                        std::span<const uint8_t> s2, void *user) {
+    auto *self = static_cast<Writer *>(user);
+    self->write(RecordType::Frame, cmd, s1, s2, self->now());
+  }
+
+  static void raw_tap(std::span<const uint8_t> data, bool accepted,
+                      void *user) {
+    auto *self = static_cast<Writer *>(user);
+    self->write(accepted ? RecordType::Raw : RecordType::Dropped, 0, data, {},
+                self->now());
+  }
+
+public:
+  Writer() = default;
+  ~Writer() { close(); }
+
+  Writer(const Writer &) = delete;
+  Writer &operator=(const Writer &) = delete;
+
+  /**
+   * @brief 创建（截断）录制文件并写入文件头，时间原点设为当前时刻
+   * @return true 如果成功
+   */
+  bool open(const char *path) noexcept {
+    close();
+    fd_ = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC,
+                 0644);
+    if (fd_ < 0)
+      return false;
+    FileHeader header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    if (::write(fd_, &header, sizeof(header)) !=
+        static_cast<ssize_t>(sizeof(header))) {
+      close();
+      return false;
+    }
+    origin_ = Clock::now();
+    records_ = 0;
+    bytes_ = sizeof(header);
+    failed_ = false;
+    return true;
+  }
+
+  /// @brief 关闭文件（析构时自动调用）
+  void close() noexcept {
+    if (fd_ >= 0)
+      ::close(fd_);
+    fd_ = -1;
+  }
+
+  [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+
+  /// @brief 是否有记录写入失败（磁盘已满等）
+  [[nodiscard]] bool failed() const noexcept { return failed_; }
+
+  /// @brief 已写入的记录数
+  [[nodiscard]] uint64_t record_count() const noexcept { return records_; }
+
+  /// @brief 文件当前大小
+  [[nodiscard]] uint64_t file_size() const noexcept { return bytes_; }
+
+  /// @brief 相对于录制开始的单调时钟纳秒数
+  [[nodiscard]] uint64_t now() const noexcept {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                             origin_)
+            .count());
+  }
+
+  /**
+   * @brief 追加一条记录
+   *
+   * @param type 记录类型
+   * @param cmd 命令码（Raw 记录传 0）
+   * @param s1 第一段数据
+   * @param s2 第二段数据（可能为空）
+   * @param time_ns 时间戳
+   * @return true 如果整条记录写入成功
+   * @note 写入不完整时文件被截断回上一条记录的末尾，之后的写入全部忽略，
+   *       failed() 返回 true
+   */
+  bool write(RecordType type, uint16_t cmd, std::span<const uint8_t> s1,
+             std::span<const uint8_t> s2, uint64_t time_ns) noexcept {
+    if (fd_ < 0 || failed_)
+      return false;
+    const size_t length = s1.size() + s2.size();
+    const RecordHeader header{static_cast<uint32_t>(length), type, cmd,
+                              time_ns};
+    static constexpr uint8_t padding[record_align]{};
+
+    iovec iov[4];
+    int n = 0;
+    iov[n++] = {const_cast<RecordHeader *>(&header), sizeof(header)};
+    if (!s1.empty())
+      iov[n++] = {const_cast<uint8_t *>(s1.data()), s1.size()};
+    if (!s2.empty())
+      iov[n++] = {const_cast<uint8_t *>(s2.data()), s2.size()};
+    const size_t total = record_size(length);
+    if (total > sizeof(header) + length)
+      iov[n++] = {const_cast<uint8_t *>(padding),
+                  total - sizeof(header) - length};
+
+    if (::writev(fd_, iov, n) != static_cast<ssize_t>(total)) {
+      // 丢弃写了一半的记录，保证文件在此之前的部分完整
+      (void)::ftruncate(fd_, static_cast<off_t>(bytes_));
+      failed_ = true;
+      return false;
+    }
+    ++records_;
+    bytes_ += total;
+    return true;
+  }
+
+  /// @brief 追加一条 Raw 记录，时间戳为当前时刻
+  bool write_raw(std::span<const uint8_t> data) noexcept {
+    return write(RecordType::Raw, 0, data, {}, now());
+  }
+
+  /**
+   * @brief 把原始字节送入 Parser 并录制
+   *
+   * 时间戳取送入前的时刻。push_data() 因缓冲区溢出失败时
+   * 整块数据未被 Parser 接收，记录为 Dropped。
+   *
+   * @return Parser::push_data() 的结果
+   * @note 不要与 attach_raw() 同时使用，否则同一块数据会被录制两次
+   */
+  template <typename ParserT>
+  auto push(ParserT &parser, const uint8_t *data, size_t length) {
+    const uint64_t arrival = now();
+    auto result = parser.push_data(data, length);
+    const bool dropped =
+        !result && result.error().code == ErrorCode::BufferOverflow;
+    write(dropped ? RecordType::Dropped : RecordType::Raw, 0, {data, length},
+          {}, arrival);
+    return result;
+  }
+
+  /**
+   * @brief 把此 Writer 设置为 Parser 的整帧旁路回调，录制每个有效帧
+   *
+   * @note Writer 必须比 Parser 的使用期更长，或在销毁前调用 detach()
+   */
+  template <typename ParserT> void attach(ParserT &parser) noexcept {
+    parser.set_frame_tap(&frame_tap, this);
+  }
+
+  /**
+   * @brief 把此 Writer 设置为 Parser 的原始字节旁路回调
+   *
+   * 录制经 push_data() 或 get_write_buffer() / advance_write_index()
+   * 送入 Parser 的每段字节，被溢出拒绝的数据块记录为 Dropped。
+   *
+   * @note Writer 必须比 Parser 的使用期更长，或在销毁前调用 detach()
+   * @note 对 parse_on_write 为 false 的策略，录制发生在生产者上下文中，
+   *       此时不要同时 attach()
+   */
+  template <typename ParserT> void attach_raw(ParserT &parser) noexcept {
+    parser.set_raw_tap(&raw_tap, this);
+  }
+
+  /// @brief 取消 attach() 与 attach_raw()
+  template <typename ParserT> static void detach(ParserT &parser) noexcept {
+    parser.set_frame_tap(nullptr);
+    parser.set_raw_tap(nullptr);
+  }
+};
+
+/**
+ * @brief 只读内存映射的录制文件
+ */
+class MappedFile {
+  const uint8_t *data_{nullptr};
+  size_t size_{0};
+
+public:
+  explicit MappedFile(const char *path) noexcept {
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+      return;
+    struct stat st{};
+    if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+      void *p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ,
+                       MAP_PRIVATE, fd, 0);
+      if (p != MAP_FAILED) {
+        data_ = static_cast<const uint8_t *>(p);
+        size_ = static_cast<size_t>(st.st_size);
+      }
+    }
+    ::close(fd);
+  }
+
+  ~MappedFile() {
+    if (data_)
+      ::munmap(const_cast<uint8_t *>(data_), size_);
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  [[nodiscard]] bool is_mapped() const noexcept { return data_ != nullptr; }
+
+  /// @brief 文件内容，映射失败时为空
+  [[nodiscard]] std::span<const uint8_t> data() const noexcept {
+    return {data_, size_};
+  }
+};
+
+/// @brief Reader 遍历得到的记录
+struct Record {
+  RecordType type;
+  uint16_t cmd;
+  uint64_t time_ns;
+  std::span<const uint8_t> data; ///< 指向文件映射内部
+};
+
+/**
+ * @brief 录制文件读取器
+ *
+ * 不拥有数据，可用于 MappedFile、整块读入内存的文件或网络接收的缓冲区。
+ */
+class Reader {
+  std::span<const uint8_t> file_;
+  size_t pos_{0};
+  bool valid_{false};
+
+public:
+  explicit Reader(std::span<const uint8_t> file) noexcept : file_(file) {
+    FileHeader header{};
+    if (file_.size() < sizeof(header))
+      return;
+    std::memcpy(&header, file_.data(), sizeof(header));
+    valid_ = std::memcmp(header.magic, magic, sizeof(magic)) == 0 &&
+             header.version == version;
+    rewind();
+  }
+
+  /// @brief 文件头是否有效
+  [[nodiscard]] bool valid() const noexcept { return valid_; }
+
+  /// @brief 回到第一条记录
+  void rewind() noexcept { pos_ = valid_ ? sizeof(FileHeader) : file_.size(); }
+
+  /**
+   * @brief 读取下一条记录
+   *
+   * @param out 输出记录
+   * @return false 如果已到文件末尾（或末尾记录不完整）
+   */
+  bool next(Record &out) noexcept {
+    RecordHeader header{};
+    if (file_.size() - pos_ < sizeof(header))
+      return false;
+    std::memcpy(&header, file_.data() + pos_, sizeof(header));
+    if (file_.size() - pos_ - sizeof(header) < header.length)
+      return false;
+    out = {header.type, header.cmd, header.time_ns,
+           file_.subspan(pos_ + sizeof(header), header.length)};
+    pos_ += std::min(record_size(header.length), file_.size() - pos_);
+    return true;
+  }
+
+  /**
+   * @brief 把剩余记录回放到 Parser
+   *
+   * 每条记录的字节经 get_write_buffer() / advance_write_index() 写入，
+   * 与实时接收走相同的解析路径。Dropped 记录不回放。
+   *
+   * @param parser 目标解析器
+   * @param speed 回放倍速：1 为原始节奏，大于 1 加速，0 表示不等待、尽快回放
+   * @return 回放的记录数；Parser 缓冲区已满且无法解析出空间时返回 BufferOverflow
+   * @note 对 parse_on_write 为 false 的缓冲区策略，需要另一线程调用
+   *       try_parse_packets() 腾出空间
+   */
+  template <typename ParserT>
+  tl::expected<size_t, Error> replay(ParserT &parser, double speed = 0.0) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    uint64_t first_ns = 0;
+    size_t count = 0;
+    Record rec{};
+    while (next(rec)) {
+      if (rec.type == RecordType::Dropped)
+        continue;
+      if (count == 0)
+        first_ns = rec.time_ns;
+      if (speed > 0.0 && rec.time_ns > first_ns) {
+        const auto offset = std::chrono::nanoseconds(static_cast<int64_t>(
+            static_cast<double>(rec.time_ns - first_ns) / speed));
+        std::this_thread::sleep_until(
+            start + std::chrono::duration_cast<Clock::duration>(offset));
+      }
+
+      auto remaining = rec.data;
+      while (!remaining.empty()) {
+        const auto dst = parser.get_write_buffer();
+        if (dst.empty())
+          return tl::unexpected(
+              Error{ErrorCode::BufferOverflow, "Parser buffer full"});
+        const size_t n = std::min(dst.size(), remaining.size());
+        std::memcpy(dst.data(), remaining.data(), n);
+        if (auto r = parser.advance_write_index(n); !r)
+          return tl::unexpected(r.error());
+        remaining = remaining.subspan(n);
+      }
+      ++count;
+    }
+    return count;
+  }
+};
+
+} // namespace RPL::Capture
+
+#endif // RPL_CAPTURE_HPP
@@ -0,0 +1,169 @@
+/**
+ * @file ParallelScan.hpp
+ * @brief RPL 多线程帧索引（主机端）
+ *
+ * 对数小时的录制数据做赛后分析时，逐字节经过 try_parse_packets()
+ * 需要数分钟。此文件把大文件切分为若干块，每个线程对自己的块调用
+ * Parser::scan_frames()，最后按顺序合并各块的帧索引，
+ * 结果与单线程 scan_frames() 对整个文件扫描完全一致。
+ *
+ * @par 设计原理
+ * - 每个线程只输出起始于本块内的帧，但帧本身可以越过块尾，
+ *   因此块边界上的帧由前一个块完整输出
+ * - 后一个块从块首开始扫描，第一个看似帧的位置可能落在上一帧的负载中；
+ *   这类位置需要同时通过起始字节、帧头 CRC8 与帧 CRC16 才会被当作完整帧跳过，
+ *   其余情况只前进 1 字节，与单线程扫描的访问路径很快重合
+ * - 合并时以前一块最后一帧的结束位置为接缝：丢弃后一块中起始于接缝之前的记录；
+ *   若后一块有 CRC 通过的帧跨越接缝（两条扫描路径未能重合），
+ *   则从接缝处对该块单线程重扫，保证结果正确
+ * - 某块因数据末尾帧不完整而提前停止时，其后的块全部丢弃
+ *
+ * @code
+ * #include <RPL/Host/ParallelScan.hpp>
+ *
+ * std::vector<RPL::FrameInfo> index;
+ * const auto [frames, consumed] =
+ *     RPL::scan_frames_parallel<RPL::Parser<SampleA, SampleB>>(capture, index);
+ * @endcode
+ */
+
+#ifndef RPL_PARALLEL_SCAN_HPP
+#define RPL_PARALLEL_SCAN_HPP
+
+#include "RPL/Parser.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace RPL {
+
+namespace Detail {
+
+/// @brief 每个线程至少处理的字节数，过小的块不值得创建线程
+inline constexpr size_t parallel_scan_min_chunk = 256 * 1024;
+
+/**
+ * @brief 单线程扫描 [begin, limit) 内起始的所有帧并追加到 out
+ *
+ * @return 单线程扫描继续的位置；小于 limit 表示遇到了数据末尾的不完整帧
+ */
+template <typename ParserT>
+size_t scan_range(std::span<const uint8_t> data, size_t begin, size_t limit,
+                  std::vector<FrameInfo> &out) {
+  std::array<FrameInfo, 512> batch;
+  size_t pos = begin;
+  while (pos < limit) {
+    const auto [frames, consumed] =
+        ParserT::scan_frames(data.subspan(pos), batch, limit - pos);
+    for (size_t i = 0; i < frames; ++i) {
+      FrameInfo info = batch[i];
+      info.offset += pos;
+      out.push_back(info);
+    }
+    pos += consumed;
+    if (frames < batch.size())
+      break;
+  }
+  return pos;
+}
+
+/// @brief 单线程扫描在该记录之后继续的位置
+inline size_t next_scan_pos(const FrameInfo &info) noexcept {
+  return info.offset + (info.crc_ok ? info.length : 1);
+}
+
+} // namespace Detail
+
+/**
+ * @brief 多线程扫描一段连续数据并建立帧索引
+ *
+ * @tparam ParserT 解析器类型（只使用其静态 scan_frames()，无需实例）
+ * @param data 输入数据
+ * @param out 帧索引追加到此 vector 末尾，偏移量相对于 data 起点
+ * @param threads 线程数，0 表示 std::thread::hardware_concurrency()；
+ *                数据量不足时会自动减少
+ * @return 追加的帧数与已处理的字节数（语义同 Parser::scan_frames()）
+ */
+template <typename ParserT>
+ScanResult scan_frames_parallel(std::span<const uint8_t> data,
+                                std::vector<FrameInfo> &out,
+                                unsigned threads = 0) {
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  const size_t chunks = std::clamp<size_t>(
+      data.size() / Detail::parallel_scan_min_chunk, 1, threads);
+  const size_t chunk_size = data.size() / chunks;
+  const size_t first = out.size();
+
+  if (chunks == 1) {
+    const size_t consumed =
+        Detail::scan_range<ParserT>(data, 0, data.size(), out);
+    return {out.size() - first, consumed};
+  }
+
+  struct Part {
+    std::vector<FrameInfo> frames;
+    size_t limit;
+    size_t stop;
+  };
+  std::vector<Part> parts(chunks);
+  {
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+    for (size_t i = 0; i < chunks; ++i) {
+      const size_t begin = i * chunk_size;
+      parts[i].limit = i + 1 == chunks ? data.size() : begin + chunk_size;
+      auto task = [&, begin, i] {
+        parts[i].frames.reserve((parts[i].limit - begin) / 32);
+        parts[i].stop = Detail::scan_range<ParserT>(data, begin,
+                                                    parts[i].limit,
+                                                    parts[i].frames);
+      };
+      if (i + 1 == chunks)
+        task();
+      else
+        workers.emplace_back(task);
+    }
+    for (auto &t : workers)
+      t.join();
+  }
+
+  // 按顺序合并，seam 为单线程扫描到达当前块时所在的位置
+  size_t seam = 0;
+  size_t consumed = 0;
+  for (auto &part : parts) {
+    if (seam >= part.limit) {
+      consumed = seam; // 整块被上一帧覆盖
+      continue;
+    }
+
+    const auto tail = std::find_if(
+        part.frames.begin(), part.frames.end(),
+        [seam](const FrameInfo &f) { return f.offset >= seam; });
+    const bool synced =
+        part.stop >= seam &&
+        std::all_of(part.frames.begin(), tail, [seam](const FrameInfo &f) {
+          return Detail::next_scan_pos(f) <= seam;
+        });
+
+    if (synced) {
+      out.insert(out.end(), tail, part.frames.end());
+      consumed = part.stop;
+    } else {
+      consumed = Detail::scan_range<ParserT>(data, seam, part.limit, out);
+    }
+    if (out.size() > first)
+      seam = std::max(seam, Detail::next_scan_pos(out.back()));
+    if (consumed < part.limit)
+      break; // 数据末尾的不完整帧，后续块无效
+  }
+  return {out.size() - first, consumed};
+}
+
+} // namespace RPL
+
+#endif // RPL_PARALLEL_SCAN_HPP
@@ -0,0 +1,369 @@
+/**
+ * @file SerialTransport.hpp
+ * @brief RPL 基于 termios + epoll 的串口接收 (Linux)
+ *
+ * 在 Linux 主机（哨兵、雷达上位机）上以事件驱动方式把串口数据送入 Parser，
+ * 取代手写的 read() + push_data() 循环。
+ *
+ * @par 设计原理
+ * - 串口以原始模式打开：关闭行规程、回显与流控，VMIN = VTIME = 0，
+ *   并尝试设置 ASYNC_LOW_LATENCY 关闭驱动的接收批处理（pty 等不支持时忽略）
+ * - epoll 等待可读事件后，read() 直接写入 Parser::get_write_buffer()，
+ *   再调用 advance_write_index() 提交，中间没有额外拷贝
+ * - 每次 read() 开始到解析完成的耗时计入 Stats，
+ *   用于评估串口到回调的延迟
+ * - Parser 缓冲区已满时暂停监听可读事件，避免水平触发的 epoll 空转；
+ *   之后每次 poll() 检查是否已有空间，有则恢复监听
+ *
+ * @code
+ * #include <RPL/Host/SerialTransport.hpp>
+ *
+ * RPL::SerialTransport transport{parser};
+ * if (!transport.open("/dev/ttyACM0", 115200))
+ *     return;
+ * while (running)
+ *     transport.poll(100);
+ * const auto &stats = transport.stats();
+ * @endcode
+ *
+ * 测试时可用 open_pty() 创建伪终端，向主端写入数据、由 SerialTransport
+ * 打开从端，无需真实硬件。
+ */
+
+#ifndef RPL_SERIAL_TRANSPORT_HPP
+#define RPL_SERIAL_TRANSPORT_HPP
+
+#if !defined(__linux__)
+#error "SerialTransport requires Linux (termios + epoll)"
+#endif
+
+#include "RPL/Utils/Error.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fcntl.h>
+#include <linux/serial.h>
+#include <span>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <thread>
+#include <tl/expected.hpp>
+#include <unistd.h>
+
+namespace RPL {
+
+/**
+ * @brief 伪终端主从对，见 open_pty()
+ */
+struct PtyPair {
+  int master{-1};                  ///< 主端文件描述符
+  std::array<char, 64> slave_path{}; ///< 从端设备路径（/dev/pts/N）
+};
+
+/**
+ * @brief 创建伪终端，主端为非阻塞原始模式
+ *
+ * @return 主从对，失败时 master 为 -1
+ */
+inline PtyPair open_pty() noexcept {
+  PtyPair pty;
+  const int fd = ::posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC | O_NONBLOCK);
+  if (fd < 0)
+    return pty;
+  termios tio{};
+  if (::grantpt(fd) != 0 || ::unlockpt(fd) != 0 ||
+      ::ptsname_r(fd, pty.slave_path.data(), pty.slave_path.size()) != 0 ||
+      ::tcgetattr(fd, &tio) != 0) {
+    ::close(fd);
+    return pty;
+  }
+  ::cfmakeraw(&tio);
+  ::tcsetattr(fd, TCSANOW, &tio);
+  pty.master = fd;
+  return pty;
+}
+
+/**
+ * @brief 串口接收器
+ *
+ * @tparam ParserT 解析器类型
+ *
+ * 不保证线程安全：poll() 与 Parser 的回调运行在调用线程中。
+ */
+template <typename ParserT> class SerialTransport {
+  using Clock = std::chrono::steady_clock;
+
+public:
+  /**
+   * @brief 接收统计
+   *
+   * 延迟为每次 read() 开始到 advance_write_index()
+   * （含解析与回调）完成的耗时。
+   */
+  struct Stats {
+    uint64_t reads{0};          ///< 成功的 read() 次数
+    uint64_t bytes{0};          ///< 累计读取字节数
+    uint64_t overflows{0};      ///< Parser 缓冲区已满而暂停监听的次数
+    uint64_t last_latency_ns{0};
+    uint64_t min_latency_ns{UINT64_MAX};
+    uint64_t max_latency_ns{0};
+    uint64_t total_latency_ns{0};
+
+    /// @brief 平均延迟（纳秒）
+    [[nodiscard]] uint64_t mean_latency_ns() const noexcept {
+      return reads ? total_latency_ns / reads : 0;
+    }
+  };
+
+private:
+  ParserT &parser_;
+  int fd_{-1};
+  int epoll_fd_{-1};
+  bool owns_fd_{false};
+  bool paused_{false}; ///< Parser 缓冲区已满，暂停监听可读事件
+  Stats stats_{};
+
+  /// @brief 暂停期间 poll() 单次等待 Parser 腾出空间的最长时间
+  static constexpr int paused_retry_ms = 1;
+
+  static constexpr speed_t to_speed(uint32_t baud) noexcept {
+    switch (baud) {
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+    case 460800: return B460800;
+    case 921600: return B921600;
+    case 1000000: return B1000000;
+    case 1500000: return B1500000;
+    case 2000000: return B2000000;
+    case 3000000: return B3000000;
+    case 4000000: return B4000000;
+    default: return B0;
+    }
+  }
+
+  void record(Clock::time_point start) noexcept {
+    const auto ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                             start)
+            .count());
+    stats_.last_latency_ns = ns;
+    stats_.min_latency_ns = std::min(stats_.min_latency_ns, ns);
+    stats_.max_latency_ns = std::max(stats_.max_latency_ns, ns);
+    stats_.total_latency_ns += ns;
+  }
+
+  /// @brief 开始或暂停监听可读事件
+  bool arm(bool enable) noexcept {
+    epoll_event ev{};
+    ev.events = enable ? static_cast<uint32_t>(EPOLLIN) : 0u;
+    ev.data.fd = fd_;
+    if (::epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, fd_, &ev) != 0)
+      return false;
+    paused_ = !enable;
+    return true;
+  }
+
+public:
+  explicit SerialTransport(ParserT &parser) noexcept : parser_(parser) {}
+  ~SerialTransport() { close(); }
+
+  SerialTransport(const SerialTransport &) = delete;
+  SerialTransport &operator=(const SerialTransport &) = delete;
+
+  /**
+   * @brief 以原始低延迟模式打开串口
+   *
+   * @param path 设备路径（/dev/ttyUSB0、/dev/ttyACM0 或 pty 从端）
+   * @param baud 波特率，必须是 termios 支持的标准值；pty 忽略此参数
+   * @return true 如果成功
+   */
+  bool open(const char *path, uint32_t baud = 115200) noexcept {
+    close();
+    const speed_t speed = to_speed(baud);
+    if (speed == B0)
+      return false;
+    const int fd = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0)
+      return false;
+
+    termios tio{};
+    if (::tcgetattr(fd, &tio) != 0) {
+      ::close(fd);
+      return false;
+    }
+    ::cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag &= ~(CSTOPB | CRTSCTS);
+    tio.c_iflag &= ~(IXON | IXOFF | IXANY);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    ::cfsetispeed(&tio, speed);
+    ::cfsetospeed(&tio, speed);
+    if (::tcsetattr(fd, TCSANOW, &tio) != 0) {
+      ::close(fd);
+      return false;
+    }
+
+    // 关闭 UART 驱动的接收批处理；pty 与部分 USB 串口不支持，忽略失败
+    serial_struct ss{};
+    if (::ioctl(fd, TIOCGSERIAL, &ss) == 0) {
+      ss.flags |= ASYNC_LOW_LATENCY;
+      ::ioctl(fd, TIOCSSERIAL, &ss);
+    }
+    ::tcflush(fd, TCIFLUSH);
+
+    if (!attach(fd)) {
+      ::close(fd);
+      return false;
+    }
+    owns_fd_ = true;
+    return true;
+  }
+
+  /**
+   * @brief 使用已打开的文件描述符（例如 pty 主端或 socket）
+   *
+   * 描述符会被设置为非阻塞，close() 时不会关闭它。
+   *
+   * @return true 如果成功加入 epoll
+   */
+  bool attach(int fd) noexcept {
+    close();
+    const int flags = ::fcntl(fd, F_GETFL);
+    if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0)
+      return false;
+    epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0)
+      return false;
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &ev) != 0) {
+      ::close(epoll_fd_);
+      epoll_fd_ = -1;
+      return false;
+    }
+    fd_ = fd;
+    owns_fd_ = false;
+    paused_ = false;
+    return true;
+  }
+
+  /// @brief 关闭 epoll 与（由 open() 打开的）串口
+  void close() noexcept {
+    if (epoll_fd_ >= 0)
+      ::close(epoll_fd_);
+    if (owns_fd_ && fd_ >= 0)
+      ::close(fd_);
+    epoll_fd_ = -1;
+    fd_ = -1;
+    owns_fd_ = false;
+    paused_ = false;
+  }
+
+  [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+
+  /// @brief 串口文件描述符，可用于发送或加入外部事件循环
+  [[nodiscard]] int native_handle() const noexcept { return fd_; }
+
+  /**
+   * @brief 等待数据并送入 Parser
+   *
+   * 可读时循环 read() 直到内核缓冲区为空（EAGAIN）或 Parser 缓冲区已满。
+   * Parser 缓冲区已满时暂停监听，数据留在内核缓冲区中；此后的 poll()
+   * 在 Parser 腾出空间前最多等待 paused_retry_ms 并返回 0，
+   * 腾出空间后恢复监听。
+   *
+   * @param timeout_ms epoll_wait() 超时，-1 表示无限等待
+   * @return 本次读取的字节数（超时为 0）；
+   *         read() / epoll_wait() 失败时返回 InternalError（errno 保留），
+   *         Parser 提交失败时返回其错误
+   */
+  tl::expected<size_t, Error> poll(int timeout_ms) {
+    if (epoll_fd_ < 0)
+      return tl::unexpected(
+          Error{ErrorCode::InternalError, "Transport not open"});
+    if (paused_) {
+      if (parser_.get_write_buffer().empty()) {
+        // 等待消费者线程解析腾出空间
+        if (timeout_ms != 0)
+          std::this_thread::sleep_for(std::chrono::milliseconds(
+              timeout_ms < 0 ? paused_retry_ms
+                             : std::min(timeout_ms, paused_retry_ms)));
+        return 0;
+      }
+      if (!arm(true))
+        return tl::unexpected(
+            Error{ErrorCode::InternalError, "epoll_ctl failed"});
+    }
+    epoll_event ev{};
+    const int ready = ::epoll_wait(epoll_fd_, &ev, 1, timeout_ms);
+    if (ready < 0)
+      return errno == EINTR ? tl::expected<size_t, Error>{0}
+                            : tl::unexpected(Error{ErrorCode::InternalError,
+                                                   "epoll_wait failed"});
+    if (ready == 0)
+      return 0;
+
+    size_t total = 0;
+    while (true) {
+      const std::span<uint8_t> dst = parser_.get_write_buffer();
+      if (dst.empty()) {
+        // 留在内核缓冲区中；暂停监听，否则水平触发的 epoll 会立即再次返回
+        ++stats_.overflows;
+        if (!arm(false))
+          return tl::unexpected(
+              Error{ErrorCode::InternalError, "epoll_ctl failed"});
+        break;
+      }
+      const Clock::time_point start = Clock::now();
+      const ssize_t n = ::read(fd_, dst.data(), dst.size());
+      if (n < 0) {
+        if (errno == EINTR)
+          continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+          break;
+        return tl::unexpected(Error{ErrorCode::InternalError, "read failed"});
+      }
+      if (n == 0)
+        break;
+      if (auto r = parser_.advance_write_index(static_cast<size_t>(n)); !r)
+        return tl::unexpected(r.error());
+      ++stats_.reads;
+      stats_.bytes += static_cast<uint64_t>(n);
+      record(start);
+      total += static_cast<size_t>(n);
+      if (static_cast<size_t>(n) < dst.size())
+        break; // 内核缓冲区已读空
+    }
+    return total;
+  }
+
+  /**
+   * @brief 发送数据（例如 Serializer 的输出）
+   *
+   * @return 实际写入的字节数，失败时返回 -1（errno 保留）
+   */
+  ssize_t write(std::span<const uint8_t> data) noexcept {
+    return ::write(fd_, data.data(), data.size());
+  }
+
+  /// @brief 接收统计
+  [[nodiscard]] const Stats &stats() const noexcept { return stats_; }
+
+  /// @brief 清零接收统计
+  void reset_stats() noexcept { stats_ = {}; }
+};
+
+} // namespace RPL
+
+#endif // RPL_SERIAL_TRANSPORT_HPP
@@ -24,19 +24,123 @@
 #include "RPL/Meta/PacketTraits.hpp"
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstdint>
+#include <cstring>
 #include <span>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace RPL::Detail {
 
+/**
+ * @brief 逐字节提取指定位数（通用实现）
+ *
+ * 超出 buffer 范围的位按 0 处理。用于常量求值、字段跨越超过 8 字节，
+ * 或 buffer 尾部不足一个完整加载窗口的情况。
+ *
+ * @tparam T 返回类型 (整数)
+ * @tparam BitOffset 起始位索引 (0 是第一个字节的 LSB)
+ * @tparam BitWidth 要提取的位数
+ * @param buffer 要读取的字节序列
+ * @return 提取的值并转换为类型 T
+ */
+template <typename T, std::size_t BitOffset, std::size_t BitWidth>
+constexpr T extract_bits_bytewise(std::span<const uint8_t> buffer) {
+    T result = 0;
+    std::size_t current_bit_offset = BitOffset;
+    std::size_t bits_extracted = 0;
+
+    // 逐字节处理
+    while (bits_extracted < BitWidth) {
+        std::size_t byte_index = current_bit_offset / 8;
+        std::size_t bit_in_byte = current_bit_offset % 8;
+
+        // 我们能从当前字节取多少位?
+        // 要么是我们还需要的剩余位，要么是该字节剩余的位
+        std::size_t bits_to_take = std::min(BitWidth - bits_extracted, static_cast<std::size_t>(8 - bit_in_byte));
+
+        // 安全检查以避免越界，尽管通常缓冲区应该足够大
+        if (byte_index >= buffer.size()) {
+            break;
+        }
+
+        uint8_t byte_val = buffer[byte_index];
+
+        // 下移以将目标位移到位置 0
+        byte_val >>= bit_in_byte;
+
+        // 屏蔽不需要的上位
+        uint8_t mask = (1ULL << bits_to_take) - 1;
+        byte_val &= mask;
+
+        // 将这些提取的位放入结果中的正确位置
+        // 由于我们从线格式的 LSB 开始提取 (假设小端位打包)
+        result |= (static_cast<T>(byte_val) << bits_extracted);
+
+        bits_extracted += bits_to_take;
+        current_bit_offset += bits_to_take;
+    }
+
+    return result;
+}
+
+/**
+ * @brief 字段覆盖的最小加载窗口
+ *
+ * 窗口从字段首字节开始，宽度为 1/2/4/8 字节中能容纳全部字段位的最小值；
+ * 字段跨越超过 8 字节时 bytes 为 0，表示只能逐字节提取。
+ *
+ * @tparam BitOffset 起始位索引
+ * @tparam BitWidth 位数
+ */
+template <std::size_t BitOffset, std::size_t BitWidth>
+struct BitWindow {
+    static constexpr std::size_t first_byte = BitOffset / 8;   ///< 窗口首字节
+    static constexpr std::size_t shift = BitOffset % 8;        ///< 窗口内的位偏移
+    static constexpr std::size_t span_bits = shift + BitWidth; ///< 需要覆盖的位数
+    static constexpr std::size_t bytes = span_bits <= 8    ? 1
+                                       : span_bits <= 16 ? 2
+                                       : span_bits <= 32 ? 4
+                                       : span_bits <= 64 ? 8
+                                                         : 0;
+    using word_type = std::conditional_t<
+        (bytes <= 4), uint32_t, uint64_t>; ///< 加载与移位使用的整数类型
+    static constexpr uint64_t mask =
+        BitWidth >= 64 ? ~uint64_t{0} : (uint64_t{1} << BitWidth) - 1;
+};
+
+/**
+ * @brief 以小端序加载 Bytes 个字节（编译器会生成单次加载）
+ * @tparam Word 结果类型
+ * @tparam Bytes 字节数 (1/2/4/8)
+ */
+template <typename Word, std::size_t Bytes>
+inline Word load_le(const uint8_t *p) noexcept {
+    if constexpr (Bytes == 1) {
+        return p[0];
+    } else if constexpr (std::endian::native == std::endian::little) {
+        std::conditional_t<Bytes == 2, uint16_t,
+                           std::conditional_t<Bytes == 4, uint32_t, uint64_t>>
+            raw;
+        std::memcpy(&raw, p, Bytes);
+        return static_cast<Word>(raw);
+    } else {
+        Word raw = 0;
+        for (std::size_t i = 0; i < Bytes; ++i)
+            raw |= static_cast<Word>(p[i]) << (8 * i);
+        return raw;
+    }
+}
+
 /**
  * @brief 在特定位偏移处从字节序列中提取指定位数
  *
  * 此函数处理跨字节位提取，采用小端线格式假设。
- * 由于 BitOffset 和 BitWidth 是编译时常量，编译器会将此优化
- * 为高效的位操作。
+ * 由于 BitOffset 和 BitWidth 是编译时常量，每个字段在编译期确定
+ * 覆盖它的 1/2/4/8 字节窗口，运行时只需一次加载、一次移位与一次掩码；
+ * 相邻字段共享同一窗口时，编译器会合并重复的加载。
  *
  * @tparam T 返回类型 (整数或 std::array)
  * @tparam BitOffset 起始位索引 (0 是第一个字节的 LSB)
@@ -45,6 +149,7 @@ namespace RPL::Detail {
  * @return 提取的值并转换为类型 T
  *
  * @note 此函数是位流解析的核心，支持跨越字节边界的位提取
+ * @note 超出 buffer 范围的位按 0 处理，此时以及常量求值时回退到逐字节实现
  * @warning 如果 BitWidth 超过 T 的容量，将触发 static_assert
  */
 template <typename T, std::size_t BitOffset, std::size_t BitWidth>
@@ -63,42 +168,18 @@ constexpr T extract_bits(std::span<const uint8_t> buffer) {
     } else {
         static_assert(BitWidth <= sizeof(T) * 8, "BitWidth exceeds return type capacity");
 
-        T result = 0;
-        std::size_t current_bit_offset = BitOffset;
-        std::size_t bits_extracted = 0;
-
-        // 逐字节处理
-        while (bits_extracted < BitWidth) {
-            std::size_t byte_index = current_bit_offset / 8;
-            std::size_t bit_in_byte = current_bit_offset % 8;
-
-            // 我们能从当前字节取多少位?
-            // 要么是我们还需要的剩余位，要么是该字节剩余的位
-            std::size_t bits_to_take = std::min(BitWidth - bits_extracted, static_cast<std::size_t>(8 - bit_in_byte));
-
-            // 安全检查以避免越界，尽管通常缓冲区应该足够大
-            if (byte_index >= buffer.size()) {
-                break;
+        using Window = BitWindow<BitOffset, BitWidth>;
+        if constexpr (Window::bytes == 0) {
+            return extract_bits_bytewise<T, BitOffset, BitWidth>(buffer);
+        } else {
+            if (std::is_constant_evaluated() ||
+                buffer.size() < Window::first_byte + Window::bytes) [[unlikely]] {
+                return extract_bits_bytewise<T, BitOffset, BitWidth>(buffer);
             }
-
-            uint8_t byte_val = buffer[byte_index];
-
-            // 下移以将目标位移到位置 0
-            byte_val >>= bit_in_byte;
-
-            // 屏蔽不需要的上位
-            uint8_t mask = (1ULL << bits_to_take) - 1;
-            byte_val &= mask;
-
-            // 将这些提取的位放入结果中的正确位置
-            // 由于我们从线格式的 LSB 开始提取 (假设小端位打包)
-            result |= (static_cast<T>(byte_val) << bits_extracted);
-
-            bits_extracted += bits_to_take;
-            current_bit_offset += bits_to_take;
+            using Word = typename Window::word_type;
+            const Word word = load_le<Word, Window::bytes>(buffer.data() + Window::first_byte);
+            return static_cast<T>((word >> Window::shift) & static_cast<Word>(Window::mask));
         }
-
-        return result;
     }
 }
 
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <array>
+#include <concepts>
 #include <tuple>
 #include <type_traits>
 
@@ -90,6 +91,20 @@ concept HasBitLayout = requires {
     typename Traits::BitLayout;
 };
 
+/**
+ * @brief 检查 PacketTraits 是否启用了写入时解码
+ *
+ * 要求定义 BitLayout 且 `decode_on_write` 为 true。
+ * 启用后 Deserializer 在写入时解码一次并保存解码后的 T，
+ * get<T>() 只需在 SeqLock 保护下拷贝，不再重复解码。
+ *
+ * @tparam Traits 要检查的 PacketTraits 特化
+ */
+template <typename Traits>
+concept DecodesOnWrite = HasBitLayout<Traits> && requires {
+    { Traits::decode_on_write } -> std::convertible_to<bool>;
+} && static_cast<bool>(Traits::decode_on_write);
+
 } // namespace RPL::Meta
 
 #endif // RPL_BITSTREAM_TRAITS_HPP
@@ -6,12 +6,13 @@
  * 包括总大小、命令码到索引的映射等。
  *
  * PacketInfoCollector 在编译期计算所有数据包的内存布局，
- * 考虑对齐要求，并生成高效的查找表（使用 frozen 库）。
+ * 考虑对齐要求，并生成高效的查找表。
  *
  * @par 设计原理
  * - 使用编译期计算避免运行时开销
  * - 考虑内存对齐以确保安全访问
- * - 使用 frozen::unordered_map 提供高效的编译期查找表
+ * - 默认使用两级稠密查找表（高字节页 → 低字节槽）定位命令表项，
+ *   定义 RPL_USE_FROZEN_CMD_MAP 时改用 frozen::unordered_map
  *
  * @author WindWeaver
  */
@@ -21,6 +22,8 @@
 #include "PacketTraits.hpp"
 #include <algorithm>
 #include <array>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 #include <frozen/unordered_map.h>
@@ -39,6 +42,18 @@ constexpr size_t align_up(size_t offset, size_t alignment) {
   return (offset + alignment - 1) & ~(alignment - 1);
 }
 
+/**
+ * @brief 命令表项
+ *
+ * 写入内存池所需的全部元信息，8 字节，便于一次加载。
+ */
+struct CmdEntry {
+  uint32_t offset;     ///< 在内存池中的偏移量
+  uint16_t size;       ///< 期望的数据长度 (PacketTraits::size)
+  uint8_t seq;         ///< 序列索引（用于 SeqLock version 数组）
+  LengthPolicy policy; ///< 长度不匹配时的处理策略
+};
+
 /**
  * @brief 数据包信息收集器
  *
@@ -74,9 +89,12 @@ template <typename... Ts> struct PacketInfoCollector {
   static constexpr void calculate_offsets(
       std::array<size_t, sizeof...(Ts)> &offsets, size_t &current_offset,
       size_t index) {
-    current_offset = align_up(current_offset, alignof(T));
+    // 启用 RPL_CACHE_LINE_ISOLATION 时，每个槽位从新的缓存行开始
+    current_offset =
+        align_up(current_offset, std::max(alignof(T), SLOT_ALIGNMENT));
     offsets[index] = current_offset;
-    current_offset += sizeof(T);
+    // 位流数据包以线格式存储，槽位需同时容纳 T 与 PacketTraits<T>::size 字节
+    current_offset += std::max(sizeof(T), PacketTraits<T>::size);
 
     if constexpr (sizeof...(Rest) > 0) {
       calculate_offsets<Rest...>(offsets, current_offset, index + 1);
@@ -98,32 +116,373 @@ template <typename... Ts> struct PacketInfoCollector {
     size_t current_offset = 0;
     calculate_offsets<Ts...>(info.offsets, current_offset, 0);
 
-    info.total_size = current_offset;
+    info.total_size = align_up(current_offset, SLOT_ALIGNMENT);
     return info;
   }();
 
   static constexpr std::size_t totalSize =
       layout.total_size; ///< 所有数据包类型的总大小（含对齐填充）
+  static constexpr std::size_t poolAlignment = std::max(
+      alignof(std::max_align_t), SLOT_ALIGNMENT); ///< 内存池的对齐要求
+
+  static_assert(sizeof...(Ts) < 0xFF,
+                "PacketInfoCollector supports at most 254 packet types");
+  static_assert(((PacketTraits<Ts>::size <= 0xFFFF) && ...),
+                "Packet size must fit in the 16-bit length field");
+
+  /**
+   * @brief 序列索引到命令表项的映射
+   *
+   * 每个表项打包了写入内存池所需的全部信息（偏移量、期望长度、
+   * 序列索引、长度策略），一次加载即可取得。
+   */
+  static constexpr auto entries = []() {
+    std::array<CmdEntry, sizeof...(Ts)> table{};
+    size_t index = 0;
+    ((table[index] =
+          CmdEntry{static_cast<uint32_t>(layout.offsets[index]),
+                   static_cast<uint16_t>(PacketTraits<Ts>::size),
+                   static_cast<uint8_t>(index), PacketTraits<Ts>::length_policy},
+      ++index),
+     ...);
+    return table;
+  }();
+
+  /// @brief 每个类型是否为子数据包（按序列索引）
+  static constexpr std::array<bool, sizeof...(Ts)> is_sub = {
+      IsSubPacket<PacketTraits<Ts>>...};
+
+  /// @brief 每个类型的命令码（子数据包为父命令码，按序列索引）
+  static constexpr std::array<uint16_t, sizeof...(Ts)> parent_cmds = {
+      static_cast<uint16_t>(PacketTraits<Ts>::cmd)...};
+
+  /// @brief 是否包含子数据包
+  static constexpr bool has_sub_packets = (IsSubPacket<PacketTraits<Ts>> || ...);
+
+  /// @brief 顶层（非子数据包）类型的数量
+  static constexpr size_t top_level_count =
+      ((IsSubPacket<PacketTraits<Ts>> ? 0 : 1) + ... + 0);
+
+  /**
+   * @brief 每个类型在查找表中使用的键
+   *
+   * 顶层数据包为 cmd，子数据包为 sub_cmd。
+   */
+  static constexpr std::array<uint16_t, sizeof...(Ts)> lut_keys = {[]() {
+    if constexpr (IsSubPacket<PacketTraits<Ts>>)
+      return static_cast<uint16_t>(PacketTraits<Ts>::sub_cmd);
+    else
+      return static_cast<uint16_t>(PacketTraits<Ts>::cmd);
+  }()...};
+
+  /**
+   * @brief 检查是否有两个类型占用同一个查找键
+   *
+   * 顶层数据包按 cmd 比较，子数据包按 (父 cmd, sub_cmd) 比较。
+   */
+  static constexpr bool has_duplicate_keys() {
+    for (size_t i = 0; i < sizeof...(Ts); ++i) {
+      for (size_t j = i + 1; j < sizeof...(Ts); ++j) {
+        if (is_sub[i] == is_sub[j] && lut_keys[i] == lut_keys[j] &&
+            parent_cmds[i] == parent_cmds[j])
+          return true;
+      }
+    }
+    return false;
+  }
+
+  static_assert((is_receivable_v<Ts> && ...),
+                "Direction::Tx packets cannot be received; use "
+                "Meta::PacketSet<...>::Rx to build the receive set");
+  static_assert(!has_duplicate_keys(),
+                "Two receivable packets share the same cmd (or cmd + sub_cmd); "
+                "mark direction-specific packets with Direction::Rx/Tx and use "
+                "Meta::PacketSet<...>::Rx");
+
+  /// @brief 表示映射中无效值的哨兵
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  /**
+   * @brief 构建顶层命令码映射的键值对
+   *
+   * frozen 不支持空表，只有子数据包时以 npos 占位。
+   */
+  template <typename ValueFn>
+  static constexpr auto top_level_pairs(ValueFn value) {
+    std::array<std::pair<uint16_t, size_t>, std::max<size_t>(top_level_count, 1)>
+        pairs{};
+    if constexpr (top_level_count == 0) {
+      pairs[0] = std::make_pair(lut_keys[0], npos);
+    } else {
+      size_t out = 0;
+      for (size_t index = 0; index < sizeof...(Ts); ++index) {
+        if (!is_sub[index])
+          pairs[out++] = std::make_pair(lut_keys[index], value(index));
+      }
+    }
+    return pairs;
+  }
 
   /**
    * @brief 命令码到索引的映射
    *
    * 静态常量映射，将命令码映射到在内存池中的偏移量。
-   * 使用 frozen::unordered_map 实现编译期查找表。
+   * 使用 frozen::unordered_map 实现编译期查找表。子数据包不参与。
    */
-  static constexpr auto cmdToIndex = []() {
-    std::array<std::pair<uint16_t, size_t>, sizeof...(Ts)> pairs{};
-    size_t index = 0;
+  static constexpr auto cmdToIndex = frozen::make_unordered_map(
+      top_level_pairs([](size_t index) { return layout.offsets[index]; }));
 
-    // 使用折叠表达式填充数组
-    ((pairs[index] =
-          std::make_pair(PacketTraits<Ts>::cmd, layout.offsets[index]),
-      ++index),
+  /**
+   * @brief 命令码到序列索引的映射（0-based 类型序号，用于 SeqLock version 数组）
+   *
+   * 此映射将命令码映射到其在模板参数列表中的序号（0, 1, 2, ...）。
+   * 用于 SeqLock 机制中定位对应的 version 计数器。子数据包不参与。
+   */
+  static constexpr auto cmdToSeqIndex = frozen::make_unordered_map(
+      top_level_pairs([](size_t index) { return index; }));
+
+  /**
+   * @brief 两级稠密查找表
+   *
+   * - pages: 键的高字节 → 页号（0xFF 表示无此页）
+   * - slots: [页号][低字节] → 序列索引（0xFF 表示未注册）
+   *
+   * 裁判系统命令码集中在少数几个高字节 (0x00xx, 0x01xx, 0x02xx, ...)，
+   * 每个出现过的高字节占用一页 256 字节的二级表。
+   *
+   * @tparam PageCount 页数
+   */
+  template <size_t PageCount> struct DenseLUT {
+    std::array<uint8_t, 256> pages;
+    std::array<std::array<uint8_t, 256>, PageCount> slots;
+
+    /// @brief 查找键对应的序列索引，未注册时返回 0xFF
+    constexpr uint8_t find(uint16_t key) const noexcept {
+      const uint8_t page = pages[key >> 8];
+      if (page == 0xFF)
+        return 0xFF;
+      return slots[page][key & 0xFF];
+    }
+  };
+
+  /**
+   * @brief 类型是否属于某张查找表
+   *
+   * 顶层表包含所有非子数据包；每个父命令码各有一张子表，
+   * 只包含该父命令码下的子数据包。
+   */
+  static constexpr bool in_table(size_t index, bool sub,
+                                 uint16_t parent) noexcept {
+    return is_sub[index] == sub && (!sub || parent_cmds[index] == parent);
+  }
+
+  /**
+   * @brief 统计一张查找表中的键占用的页数
+   *
+   * @param sub false 为顶层表，true 为 parent 的子表
+   * @param parent 父命令码（仅 sub 为 true 时使用）
+   */
+  static constexpr size_t count_pages(bool sub, uint16_t parent = 0) {
+    std::array<bool, 256> used{};
+    size_t count = 0;
+    for (size_t index = 0; index < sizeof...(Ts); ++index) {
+      if (!in_table(index, sub, parent))
+        continue;
+      const uint8_t hi = static_cast<uint8_t>(lut_keys[index] >> 8);
+      if (!used[hi]) {
+        used[hi] = true;
+        ++count;
+      }
+    }
+    return count;
+  }
+
+  /**
+   * @brief 构建一张稠密查找表
+   *
+   * @tparam PageCount 页数，不少于 count_pages(sub, parent)
+   */
+  template <size_t PageCount>
+  static constexpr auto build_lut(bool sub, uint16_t parent = 0) {
+    DenseLUT<PageCount> table{};
+    table.pages.fill(0xFF);
+    for (auto &page : table.slots)
+      page.fill(0xFF);
+
+    size_t next_page = 0;
+    for (size_t index = 0; index < sizeof...(Ts); ++index) {
+      if (!in_table(index, sub, parent))
+        continue;
+      const uint16_t key = lut_keys[index];
+      const uint8_t hi = static_cast<uint8_t>(key >> 8);
+      if (table.pages[hi] == 0xFF)
+        table.pages[hi] = static_cast<uint8_t>(next_page++);
+      table.slots[table.pages[hi]][key & 0xFF] = static_cast<uint8_t>(index);
+    }
+    return table;
+  }
+
+  static constexpr size_t page_count = count_pages(false); ///< 顶层查找表页数
+  static constexpr auto denseLUT =
+      build_lut<page_count>(false); ///< 命令码 → 序列索引
+
+  /// @brief 不同父命令码的数量（每个父命令码一张子表）
+  static constexpr size_t sub_parent_count = []() {
+    size_t count = 0;
+    for (size_t i = 0; i < sizeof...(Ts); ++i) {
+      bool seen = false;
+      for (size_t j = 0; j < i; ++j)
+        seen = seen || (is_sub[j] && parent_cmds[j] == parent_cmds[i]);
+      if (is_sub[i] && !seen)
+        ++count;
+    }
+    return count;
+  }();
+
+  /// @brief 子表对应的父命令码（按首次出现顺序）
+  static constexpr auto sub_parents = []() {
+    std::array<uint16_t, sub_parent_count> parents{};
+    size_t count = 0;
+    for (size_t i = 0; i < sizeof...(Ts); ++i) {
+      bool seen = false;
+      for (size_t j = 0; j < count; ++j)
+        seen = seen || parents[j] == parent_cmds[i];
+      if (is_sub[i] && !seen)
+        parents[count++] = parent_cmds[i];
+    }
+    return parents;
+  }();
+
+  /// @brief 子表统一的页数（各父命令码所需页数的最大值）
+  static constexpr size_t sub_page_count = []() {
+    size_t pages = 0;
+    for (const uint16_t parent : sub_parents)
+      pages = std::max(pages, count_pages(true, parent));
+    return pages;
+  }();
+
+  /// @brief 每个父命令码的子命令码 → 序列索引表，与 sub_parents 一一对应
+  static constexpr auto subLUTs = []() {
+    std::array<DenseLUT<sub_page_count>, sub_parent_count> tables{};
+    for (size_t i = 0; i < sub_parent_count; ++i)
+      tables[i] = build_lut<sub_page_count>(true, sub_parents[i]);
+    return tables;
+  }();
+
+  /**
+   * @brief 根据命令码获取命令表项
+   *
+   * 默认使用两级稠密查找表（两次字节加载 + 一次表项加载，无哈希计算）；
+   * 定义 RPL_USE_FROZEN_CMD_MAP 时改用 frozen 完美哈希表。
+   *
+   * @param cmd 命令码
+   * @return 指向表项的指针，如果命令码不存在则返回 nullptr
+   * @note 只查找顶层数据包，子数据包请使用 sub_entry()
+   */
+  static constexpr const CmdEntry *cmd_entry(uint16_t cmd) noexcept {
+#ifdef RPL_USE_FROZEN_CMD_MAP
+    auto it = cmdToSeqIndex.find(cmd);
+    return it != cmdToSeqIndex.end() && it->second != npos
+               ? &entries[it->second]
+               : nullptr;
+#else
+    const uint8_t seq = denseLUT.find(cmd);
+    return seq != 0xFF ? &entries[seq] : nullptr;
+#endif
+  }
+
+  // --- 子数据包 (二级分发) ---
+
+  /// @brief 子命令码在父负载中的偏移量（所有子数据包共用）
+  static constexpr size_t sub_cmd_offset = []() {
+    size_t offset = 0;
+    ((IsSubPacket<PacketTraits<Ts>> ? (offset = PacketTraits<Ts>::sub_cmd_offset)
+                                    : 0),
      ...);
+    return offset;
+  }();
 
-    return frozen::make_unordered_map(pairs);
+  /// @brief 子数据包内容之前的父负载字节数（所有子数据包共用）
+  static constexpr size_t sub_header_size = []() {
+    size_t size = 0;
+    ((IsSubPacket<PacketTraits<Ts>> ? (size = PacketTraits<Ts>::sub_header_size)
+                                    : 0),
+     ...);
+    return size;
   }();
 
+  static_assert(
+      ((!IsSubPacket<PacketTraits<Ts>> ||
+        (PacketTraits<Ts>::sub_cmd_offset == sub_cmd_offset &&
+         PacketTraits<Ts>::sub_header_size == sub_header_size)) &&
+       ...),
+      "All sub packets must share sub_cmd_offset and sub_header_size");
+  static_assert(!has_sub_packets || sub_cmd_offset + 2 <= sub_header_size,
+                "sub_cmd must lie within sub_header_size");
+
+  /**
+   * @brief 检查命令码是否是某个子数据包的父命令码
+   * @param cmd 命令码
+   * @return true 如果需要进行二级分发
+   */
+  static constexpr bool is_sub_parent(uint16_t cmd) noexcept {
+    return ((IsSubPacket<PacketTraits<Ts>> && PacketTraits<Ts>::cmd == cmd) ||
+            ...);
+  }
+
+  /**
+   * @brief 根据父命令码与子命令码获取子数据包的命令表项
+   *
+   * @param cmd 父命令码
+   * @param sub_cmd 子命令码
+   * @return 指向表项的指针，如果未注册则返回 nullptr
+   */
+  static constexpr const CmdEntry *sub_entry(uint16_t cmd,
+                                             uint16_t sub_cmd) noexcept {
+    for (size_t i = 0; i < sub_parent_count; ++i) {
+      if (sub_parents[i] != cmd)
+        continue;
+      const uint8_t seq = subLUTs[i].find(sub_cmd);
+      return seq != 0xFF ? &entries[seq] : nullptr;
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief 解析父负载中的子数据包
+   *
+   * 读取子命令码并查找表项；找到时把 s1/s2 收窄为子数据包内容
+   * （去掉 sub_header_size 字节）。
+   *
+   * @param cmd 父命令码
+   * @param s1 父负载第一段（找到时被修改）
+   * @param s2 父负载第二段（找到时被修改）
+   * @return 子数据包表项，不是父命令码或未注册时返回 nullptr
+   */
+  static constexpr const CmdEntry *
+  resolve_sub_packet(uint16_t cmd, std::span<const uint8_t> &s1,
+                     std::span<const uint8_t> &s2) noexcept {
+    if (!is_sub_parent(cmd) || s1.size() + s2.size() < sub_header_size)
+      return nullptr;
+
+    auto byte_at = [&](size_t i) {
+      return i < s1.size() ? s1[i] : s2[i - s1.size()];
+    };
+    const uint16_t sub_cmd = static_cast<uint16_t>(
+        byte_at(sub_cmd_offset) | (byte_at(sub_cmd_offset + 1) << 8));
+    const auto *entry = sub_entry(cmd, sub_cmd);
+    if (!entry)
+      return nullptr;
+
+    if (s1.size() >= sub_header_size) {
+      s1 = s1.subspan(sub_header_size);
+    } else {
+      s2 = s2.subspan(sub_header_size - s1.size());
+      s1 = {};
+    }
+    return entry;
+  }
+
   /**
    * @brief 获取指定类型的索引
    *
@@ -133,7 +492,7 @@ template <typename... Ts> struct PacketInfoCollector {
    * @return 该类型的索引（偏移量）
    */
   template <typename T> static constexpr size_t type_index() noexcept {
-    return cmd_index(PacketTraits<T>::cmd);
+    return entries[type_seq_index<T>()].offset;
   }
 
   /**
@@ -145,33 +504,50 @@ template <typename... Ts> struct PacketInfoCollector {
    * @return 对应的索引（偏移量），如果命令码不存在则返回-1
    */
   static constexpr size_t cmd_index(uint16_t cmd) noexcept {
-    auto it = cmdToIndex.find(cmd);
-    return it != cmdToIndex.end() ? it->second : static_cast<size_t>(-1);
+    const auto *entry = cmd_entry(cmd);
+    return entry ? entry->offset : static_cast<size_t>(-1);
   }
 
   /**
-   * @brief 命令码到序列索引的映射（0-based 类型序号，用于 SeqLock version 数组）
+   * @brief 根据命令码获取序列索引
    *
-   * 此映射将命令码映射到其在模板参数列表中的序号（0, 1, 2, ...）。
-   * 用于 SeqLock 机制中定位对应的 version 计数器。
+   * @param cmd 命令码
+   * @return 对应的序列索引（0-based 类型序号），如果命令码不存在则返回-1
    */
-  static constexpr auto cmdToSeqIndex = []() {
-    std::array<std::pair<uint16_t, size_t>, sizeof...(Ts)> pairs{};
-    size_t index = 0;
-    ((pairs[index] = std::make_pair(PacketTraits<Ts>::cmd, index), ++index),
-     ...);
-    return frozen::make_unordered_map(pairs);
-  }();
+  static constexpr size_t cmd_seq_index(uint16_t cmd) noexcept {
+    const auto *entry = cmd_entry(cmd);
+    return entry ? entry->seq : static_cast<size_t>(-1);
+  }
 
   /**
-   * @brief 根据命令码获取序列索引
+   * @brief 根据序列索引获取期望的数据长度
+   *
+   * @param seq 序列索引（必须有效）
+   * @return 期望的数据长度（字节）
+   */
+  static constexpr size_t seq_size(size_t seq) noexcept {
+    return entries[seq].size;
+  }
+
+  /**
+   * @brief 根据序列索引获取长度不匹配处理策略
+   *
+   * @param seq 序列索引（必须有效）
+   * @return 该数据包的 LengthPolicy
+   */
+  static constexpr LengthPolicy seq_length_policy(size_t seq) noexcept {
+    return entries[seq].policy;
+  }
+
+  /**
+   * @brief 根据命令码获取期望的数据长度
    *
    * @param cmd 命令码
-   * @return 对应的序列索引（0-based 类型序号），如果命令码不存在则返回-1
+   * @return 期望的数据长度（字节），如果命令码不存在则返回-1
    */
-  static constexpr size_t cmd_seq_index(uint16_t cmd) noexcept {
-    auto it = cmdToSeqIndex.find(cmd);
-    return it != cmdToSeqIndex.end() ? it->second : static_cast<size_t>(-1);
+  static constexpr size_t cmd_size(uint16_t cmd) noexcept {
+    const auto *entry = cmd_entry(cmd);
+    return entry ? entry->size : static_cast<size_t>(-1);
   }
 
   /**
@@ -181,7 +557,13 @@ template <typename... Ts> struct PacketInfoCollector {
    * @return 该类型的序列索引（0-based 类型序号）
    */
   template <typename T> static constexpr size_t type_seq_index() noexcept {
-    return cmd_seq_index(PacketTraits<T>::cmd);
+    constexpr size_t index = []() {
+      size_t i = 0;
+      ((std::is_same_v<T, Ts> ? false : (++i, true)) && ...);
+      return i;
+    }();
+    static_assert(index < sizeof...(Ts), "T is not registered");
+    return index;
   }
 };
 } // namespace RPL::Meta
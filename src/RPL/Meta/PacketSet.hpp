@@ -0,0 +1,83 @@
+/**
+ * @file PacketSet.hpp
+ * @brief RPL 按传输方向拆分的数据包集合
+ *
+ * 裁判系统中部分单向数据包共用命令码（例如服务器下发的 EventData 与
+ * 机器人发送的 InteractionFigure 均为 0x0101）。PacketSet 允许项目只维护
+ * 一份完整的类型列表，再按 PacketTraits::direction 在编译期拆分出
+ * 接收集合与发送集合，分别实例化 Deserializer / Parser 与 Serializer。
+ *
+ * @par 设计原理
+ * - 拆分完全在编译期完成，运行时查找表中只包含接收集合，没有额外开销
+ * - 接收集合中若仍有重复命令码，PacketInfoCollector 会在编译期报错
+ *
+ * @code
+ * using Packets = RPL::Meta::PacketSet<EventData, InteractionFigure, RobotStatus>;
+ *
+ * Packets::Rx::apply<RPL::Deserializer> deserializer;           // EventData, RobotStatus
+ * Packets::Rx::apply<RPL::Parser> parser{deserializer};
+ * Packets::Tx::apply<RPL::Serializer> serializer;               // 三者均可发送
+ * @endcode
+ */
+
+#ifndef RPL_PACKET_SET_HPP
+#define RPL_PACKET_SET_HPP
+
+#include "PacketTraits.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace RPL::Meta {
+
+template <typename... Ts> struct PacketSet;
+
+namespace Details {
+template <template <typename> class Pred, typename Out, typename... Ts>
+struct FilterImpl {
+  using type = Out;
+};
+
+template <template <typename> class Pred, typename... Os, typename H,
+          typename... Ts>
+struct FilterImpl<Pred, PacketSet<Os...>, H, Ts...> {
+  using type = typename FilterImpl<
+      Pred,
+      std::conditional_t<Pred<H>::value, PacketSet<Os..., H>, PacketSet<Os...>>,
+      Ts...>::type;
+};
+
+template <typename T>
+struct Receivable : std::bool_constant<is_receivable_v<T>> {};
+template <typename T>
+struct Transmittable : std::bool_constant<is_transmittable_v<T>> {};
+} // namespace Details
+
+/**
+ * @brief 数据包类型集合
+ *
+ * @tparam Ts 数据包类型列表
+ */
+template <typename... Ts> struct PacketSet {
+  /// @brief 可接收的数据包（direction 不为 Tx）
+  using Rx = typename Details::FilterImpl<Details::Receivable, PacketSet<>,
+                                          Ts...>::type;
+  /// @brief 可发送的数据包（direction 不为 Rx）
+  using Tx = typename Details::FilterImpl<Details::Transmittable, PacketSet<>,
+                                          Ts...>::type;
+
+  /**
+   * @brief 用集合中的类型实例化模板
+   *
+   * @tparam C 目标模板（Deserializer、Parser、Serializer 等）
+   * @tparam Prefix 放在数据包类型之前的额外参数（如 Parser 的缓冲区策略）
+   */
+  template <template <typename...> class C, typename... Prefix>
+  using apply = C<Prefix..., Ts...>;
+
+  /// @brief 集合中的类型数量
+  static constexpr size_t size = sizeof...(Ts);
+};
+
+} // namespace RPL::Meta
+
+#endif // RPL_PACKET_SET_HPP
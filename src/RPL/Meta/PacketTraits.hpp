@@ -22,9 +22,16 @@
 #define RPL_INFO_HPP
 
 #include "RPL/Utils/Def.hpp"
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
 
+#ifndef RPL_EVENT_HISTORY_DEPTH
+/// 内置事件型数据包（HurtData、ShootData、RefereeWarning）的历史队列深度，
+/// 默认 0 表示与其他数据包相同，只保留最新值
+#define RPL_EVENT_HISTORY_DEPTH 0
+#endif
+
 namespace RPL::Meta {
 /**
  * @brief 默认 RoboMaster 协议定义
@@ -80,9 +87,20 @@ struct DefaultProtocol {
    * @brief 整包校验使用的CRC算法类型
    *
    * 必须提供静态 calc 函数: static uint16_t calc(const void* data, size_t len,
-   * uint16_t init = ...); 默认使用 RoboMaster 标准 CRC16
+   * uint16_t init = ...); 默认使用 RoboMaster 标准 CRC16。
+   * 定义 RPL_USE_CLMUL_CRC 时改用无进位乘法折叠实现（仅适用于 x86-64 /
+   * AArch64 主机）
    */
+#ifdef RPL_USE_CLMUL_CRC
+  using RPL_CRC = RPL::ProtocolCRC16Clmul;
+#else
   using RPL_CRC = RPL::ProtocolCRC16;
+#endif
+
+  /*
+   * 可选：帧头校验使用的 CRC 算法类型 `using RPL_HEADER_CRC = ...;`
+   * 未定义时使用 RPL::ProtocolCRC8，见 HeaderCRC_t
+   */
 
   // --- 长度获取策略 ---
   /**
@@ -107,6 +125,97 @@ struct DefaultProtocol {
   static constexpr size_t cmd_field_bytes = 2; ///< 命令码字段占用的字节数
 };
 
+/**
+ * @brief 数据长度不匹配时的处理策略
+ *
+ * 当帧头中的数据长度与 PacketTraits::size 不一致时（例如固件版本不同，
+ * 或 CRC 恰好通过的损坏帧），Deserializer 在写入内存池之前按此策略处理。
+ */
+enum class LengthPolicy : uint8_t {
+  Reject,        ///< 丢弃该帧，不写入内存池
+  TruncateOrPad, ///< 超长部分截断，不足部分补零
+};
+
+/**
+ * @brief 数据包的传输方向
+ *
+ * 裁判系统的部分机器人发送数据（如 0x0301 内容中的图形子协议）
+ * 与服务器下发的数据共用同一个命令码，例如 InteractionFigure 与 EventData
+ * 均为 0x0101。按方向区分后，同一个类型列表可以拆分为互不冲突的
+ * 接收集合与发送集合，见 PacketSet。
+ */
+enum class Direction : uint8_t {
+  Both, ///< 可接收也可发送（默认）
+  Rx,   ///< 仅接收：不能用于 Serializer
+  Tx,   ///< 仅发送：不能用于 Deserializer / Parser
+};
+
+/**
+ * @brief 获取协议帧头校验使用的 CRC 算法类型
+ *
+ * 如果 Protocol 定义了 RPL_HEADER_CRC 则使用它，否则回退到 RPL::ProtocolCRC8。
+ *
+ * @tparam P 协议类型
+ */
+template <typename P> struct HeaderCRC {
+  using type = RPL::ProtocolCRC8;
+};
+
+template <typename P>
+  requires requires { typename P::RPL_HEADER_CRC; }
+struct HeaderCRC<P> {
+  using type = typename P::RPL_HEADER_CRC;
+};
+
+/// @brief HeaderCRC 的便捷别名
+template <typename P> using HeaderCRC_t = typename HeaderCRC<P>::type;
+
+/**
+ * @brief 检查数据包是否是子数据包
+ *
+ * 子数据包与父数据包共用 cmd（如 0x0301 RobotInteractionData），
+ * 由父负载中 sub_cmd_offset 处的 16 位子命令码区分。
+ * Deserializer 会把每个子命令的内容（去掉 sub_header_size 字节）
+ * 存入独立的槽位，可直接 get<SubPacket>()。子数据包仅用于接收。
+ *
+ * @par 使用示例
+ * @code
+ * struct ArmorTarget { float x, y, z; } __attribute__((packed));
+ *
+ * template <>
+ * struct RPL::Meta::PacketTraits<ArmorTarget>
+ *     : PacketTraitsBase<PacketTraits<ArmorTarget>> {
+ *     static constexpr uint16_t cmd = 0x0301;
+ *     static constexpr uint16_t sub_cmd = 0x0201;
+ *     static constexpr size_t size = sizeof(ArmorTarget);
+ * };
+ * @endcode
+ *
+ * @note Parser 的缓冲区按 sub_header_size + size 估算子数据包的帧长；
+ *       若发送方总是发送定长（补齐到 112 字节）的父负载，请同时注册父数据包
+ *
+ * @tparam Traits PacketTraits 特化
+ */
+template <typename Traits>
+concept IsSubPacket = requires {
+  { Traits::sub_cmd } -> std::convertible_to<uint16_t>;
+};
+
+/**
+ * @brief 获取数据包的历史队列深度
+ *
+ * 未定义 history_depth 的 PacketTraits 视为 0（只保留最新值）。
+ *
+ * @tparam Traits PacketTraits 特化
+ */
+template <typename Traits>
+inline constexpr size_t history_depth_v = [] {
+  if constexpr (requires { Traits::history_depth; })
+    return static_cast<size_t>(Traits::history_depth);
+  else
+    return size_t{0};
+}();
+
 /**
  * @brief 数据包特性基类
  *
@@ -138,6 +247,43 @@ template <typename Derived> struct PacketTraitsBase {
   /// @brief 默认使用 RoboMaster 协议，派生类可通过 `using Protocol = MyProtocol;` 覆盖
   using Protocol = DefaultProtocol;
 
+  /// @brief 默认丢弃长度不匹配的帧，变长数据包可覆盖为 LengthPolicy::TruncateOrPad
+  static constexpr LengthPolicy length_policy = LengthPolicy::Reject;
+
+  /**
+   * @brief 是否在写入时解码 BitLayout（仅对定义了 BitLayout 的数据包生效）
+   *
+   * 默认 false：内存池保存原始字节，每次 get() 时解码。
+   * 读取频率远高于接收频率的数据包可覆盖为 true，
+   * 由 Deserializer 在写入时解码一次，get() 退化为普通拷贝。
+   */
+  static constexpr bool decode_on_write = false;
+
+  /**
+   * @brief 历史队列深度（2 的幂），0 表示只保留最新值
+   *
+   * 大于 0 时 Deserializer 额外为该类型维护一个 SPSC 历史队列，
+   * 保留每一条尚未被 pop_history() 取走的记录，适用于事件型数据包。
+   */
+  static constexpr size_t history_depth = 0;
+
+  /**
+   * @brief 子数据包的子命令码在父数据包负载中的偏移量
+   *
+   * 仅对定义了 sub_cmd 的子数据包生效，默认对应 0x0301 的 data_cmd_id。
+   */
+  static constexpr size_t sub_cmd_offset = 0;
+  /**
+   * @brief 子数据包内容之前的父负载字节数
+   *
+   * 仅对定义了 sub_cmd 的子数据包生效，默认对应 0x0301 的
+   * data_cmd_id + sender_id + receiver_id 共 6 字节。
+   */
+  static constexpr size_t sub_header_size = 6;
+
+  /// @brief 传输方向，与其他数据包共用命令码的单向数据包应覆盖此值
+  static constexpr Direction direction = Direction::Both;
+
   /**
    * @brief 获取数据包前的处理
    *
@@ -167,6 +313,11 @@ template <typename Derived> struct PacketTraitsBase {
  * - 必须定义 `cmd` 静态常量（命令码）
  * - 必须定义 `size` 静态常量（数据包大小）
  * - 可选定义 `BitLayout` 类型（用于位流序列化/反序列化）
+ * - 可选定义 `length_policy`（长度不匹配时的处理策略）
+ * - 可选定义 `decode_on_write`（BitLayout 数据包在写入时解码）
+ * - 可选定义 `history_depth`（事件型数据包的历史队列深度）
+ * - 可选定义 `sub_cmd`（子数据包：按父负载中的子命令码二级分发，见 IsSubPacket）
+ * - 可选定义 `direction`（传输方向，用于拆分接收/发送集合，见 PacketSet）
  * - 可选定义 `before_get_custom` 函数（获取前处理）
  *
  * @par 完整特化示例
@@ -190,6 +341,16 @@ template <typename Derived> struct PacketTraitsBase {
  * @endcode
  */
 template <typename T> struct PacketTraits;
+
+/// @brief 数据包是否可以被接收（Deserializer / Parser）
+template <typename T>
+inline constexpr bool is_receivable_v =
+    PacketTraits<T>::direction != Direction::Tx;
+
+/// @brief 数据包是否可以被发送（Serializer）
+template <typename T>
+inline constexpr bool is_transmittable_v =
+    PacketTraits<T>::direction != Direction::Rx;
 } // namespace RPL::Meta
 
 #endif // RPL_INFO_HPP
@@ -0,0 +1,100 @@
+/**
+ * @file PacketView.hpp
+ * @brief RPL 数据包负载零拷贝视图
+ *
+ * 此文件定义 PacketView 类，用于在解析回调中直接访问 Parser 缓冲区内的
+ * 数据包负载，而无需先拷贝到 Deserializer 的内存池。
+ *
+ * @par 设计原理
+ * - 负载可能跨越环形缓冲区边界，因此视图由最多两段 span 组成
+ * - 视图只在回调执行期间有效，回调返回后缓冲区中的数据会被丢弃
+ * - get() 按 PacketTraits 的规则（截断/补零、before_get、BitLayout）构造 T
+ */
+
+#ifndef RPL_PACKET_VIEW_HPP
+#define RPL_PACKET_VIEW_HPP
+
+#include "Meta/BitstreamParser.hpp"
+#include "Meta/PacketTraits.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace RPL {
+
+/**
+ * @brief 数据包负载的零拷贝视图
+ *
+ * @tparam T 数据包类型
+ *
+ * @par 使用示例
+ * @code
+ * parser.on<ShootData>([](const RPL::PacketView<ShootData> &view, void *) {
+ *     const ShootData shot = view.get();
+ *     // 处理每一次射击事件...
+ * });
+ * @endcode
+ *
+ * @warning 视图引用 Parser 内部缓冲区，不得在回调返回后继续使用
+ */
+template <typename T> struct PacketView {
+  std::span<const uint8_t> first;  ///< 第一段负载
+  std::span<const uint8_t> second; ///< 第二段负载（跨越缓冲区边界时非空）
+
+  /// @brief 负载总长度（帧中携带的实际长度，可能与 PacketTraits::size 不同）
+  [[nodiscard]] size_t size() const noexcept {
+    return first.size() + second.size();
+  }
+
+  /// @brief 负载是否位于一段连续内存中
+  [[nodiscard]] bool contiguous() const noexcept { return second.empty(); }
+
+  /**
+   * @brief 将负载拷贝到目标缓冲区
+   *
+   * @param dst 目标指针
+   * @param n 最多拷贝的字节数
+   * @return 实际拷贝的字节数
+   */
+  size_t copy_to(uint8_t *dst, size_t n) const noexcept {
+    const size_t n1 = std::min(n, first.size());
+    const size_t n2 = std::min(n - n1, second.size());
+    if (n1 > 0)
+      std::memcpy(dst, first.data(), n1);
+    if (n2 > 0)
+      std::memcpy(dst + n1, second.data(), n2);
+    return n1 + n2;
+  }
+
+  /**
+   * @brief 构造数据包
+   *
+   * 与 Deserializer::get() 的结果一致：超长部分截断、不足部分补零，
+   * 执行 before_get，并在定义了 BitLayout 时进行位流解码。
+   *
+   * @return 数据包副本
+   */
+  [[nodiscard]] T get() const noexcept {
+    using Traits = Meta::PacketTraits<T>;
+    if constexpr (Meta::HasBitLayout<Traits>) {
+      uint8_t raw[Traits::size]{};
+      copy_to(raw, Traits::size);
+      Traits::before_get(raw);
+      return deserialize_bitstream<T>(
+          std::span<const uint8_t>(raw, Traits::size));
+    } else {
+      alignas(T) uint8_t raw[std::max(sizeof(T), Traits::size)]{};
+      copy_to(raw, Traits::size);
+      Traits::before_get(raw);
+      T result;
+      std::memcpy(&result, raw, sizeof(T));
+      return result;
+    }
+  }
+};
+
+} // namespace RPL
+
+#endif // RPL_PACKET_VIEW_HPP
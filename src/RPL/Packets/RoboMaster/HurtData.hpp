@@ -21,6 +21,7 @@ struct RPL::Meta::PacketTraits<HurtData> : PacketTraitsBase<PacketTraits<HurtDat
 {
     static constexpr uint16_t cmd = 0x0206;
     static constexpr size_t size = 1;
+    static constexpr size_t history_depth = RPL_EVENT_HISTORY_DEPTH;
     using BitLayout = std::tuple<
         Field<uint8_t, 4>,
         Field<uint8_t, 4>
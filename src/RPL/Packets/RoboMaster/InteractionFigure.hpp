@@ -32,6 +32,7 @@ struct RPL::Meta::PacketTraits<InteractionFigure> : PacketTraitsBase<PacketTrait
 {
     static constexpr uint16_t cmd = 0x0101;
     static constexpr size_t size = 15;
+    static constexpr Direction direction = Direction::Tx; ///< 机器人发送，与 EventData 共用 0x0101
     using BitLayout = std::tuple<
         Field<std::array<uint8_t, 3>, 24>,
         Field<uint32_t, 3>,
@@ -19,5 +19,6 @@ struct RPL::Meta::PacketTraits<InteractionLayerDelete> : PacketTraitsBase<Packet
 {
     static constexpr uint16_t cmd = 0x0100;
     static constexpr size_t size = sizeof(InteractionLayerDelete);
+    static constexpr Direction direction = Direction::Tx; ///< 机器人发送的子协议内容
 };
 #endif // RPL_INTERACTIONLAYERDELETE_HPP
@@ -19,5 +19,6 @@ struct RPL::Meta::PacketTraits<InteractionString> : PacketTraitsBase<PacketTrait
 {
     static constexpr uint16_t cmd = 0x0110;
     static constexpr size_t size = sizeof(InteractionString);
+    static constexpr Direction direction = Direction::Tx; ///< 机器人发送的子协议内容
 };
 #endif // RPL_INTERACTIONSTRING_HPP
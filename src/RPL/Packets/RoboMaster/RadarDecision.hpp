@@ -22,6 +22,7 @@ struct RPL::Meta::PacketTraits<RadarDecision> : PacketTraitsBase<PacketTraits<Ra
 {
     static constexpr uint16_t cmd = 0x0121;
     static constexpr size_t size = 8;
+    static constexpr Direction direction = Direction::Tx; ///< 机器人发送的子协议内容
     using BitLayout = std::tuple<
         Field<uint8_t, 1>,
         Field<uint8_t, 8>,
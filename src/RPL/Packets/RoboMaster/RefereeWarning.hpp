@@ -20,5 +20,6 @@ struct RPL::Meta::PacketTraits<RefereeWarning> : PacketTraitsBase<PacketTraits<R
 {
     static constexpr uint16_t cmd = 0x0104;
     static constexpr size_t size = sizeof(RefereeWarning);
+    static constexpr size_t history_depth = RPL_EVENT_HISTORY_DEPTH;
 };
 #endif // RPL_REFEREEWARNING_HPP
@@ -21,5 +21,6 @@ struct RPL::Meta::PacketTraits<RobotInteractionData> : PacketTraitsBase<PacketTr
 {
     static constexpr uint16_t cmd = 0x0301;
     static constexpr size_t size = sizeof(RobotInteractionData);
+    static constexpr LengthPolicy length_policy = LengthPolicy::TruncateOrPad; ///< 内容数据段为变长
 };
 #endif // RPL_ROBOTINTERACTIONDATA_HPP
@@ -27,6 +27,7 @@ struct RPL::Meta::PacketTraits<SentryDecision> : PacketTraitsBase<PacketTraits<S
 {
     static constexpr uint16_t cmd = 0x0120;
     static constexpr size_t size = 4;
+    static constexpr Direction direction = Direction::Tx; ///< 机器人发送的子协议内容
     using BitLayout = std::tuple<
         Field<uint32_t, 1>,
         Field<uint32_t, 1>,
@@ -21,5 +21,6 @@ struct RPL::Meta::PacketTraits<ShootData> : PacketTraitsBase<PacketTraits<ShootD
 {
     static constexpr uint16_t cmd = 0x0207;
     static constexpr size_t size = sizeof(ShootData);
+    static constexpr size_t history_depth = RPL_EVENT_HISTORY_DEPTH;
 };
 #endif // RPL_SHOOTDATA_HPP
@@ -13,18 +13,22 @@
 #define RPL_PARSER_HPP
 
 #include "Containers/BipBuffer.hpp"
+#include "Containers/SpscBipBuffer.hpp"
 #include "Deserializer.hpp"
 #include "Meta/PacketTraits.hpp"
+#include "PacketView.hpp"
 #include "Utils/ConnectionMonitor.hpp"
 #include "Utils/Def.hpp"
 #include "Utils/Error.hpp"
+#include "Utils/StartByteScanner.hpp"
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <cstdint>
 #include <cstring>
 #include <optional>
+#include <span>
 #include <tl/expected.hpp>
-#include <tuple>
 #include <type_traits>
 
 /**
@@ -69,38 +73,18 @@ struct UniqueImpl<TypeList<H, Ts...>, TypeList<Os...>> {
 template <typename... Ts>
 using UniqueTypes_t = typename UniqueImpl<TypeList<Ts...>, TypeList<>>::type;
 
-/**
- * @brief 运行时获取 Tuple 元素
- *
- * 根据索引在运行时选择 tuple 元素并调用函数。
- * 用于在运行时根据协议索引分发到编译期生成的 Worker。
- *
- * @tparam Tuple Tuple 类型
- * @tparam Fn 函数对象类型
- * @param i 索引
- * @param t Tuple 实例
- * @param f 要调用的函数
- */
-template <typename Tuple, typename Fn, size_t... Is>
-constexpr void tuple_switch(size_t i, Tuple &&t, Fn &&f,
-                            std::index_sequence<Is...>) {
-  ((i == Is ? f(std::get<Is>(t)) : void()), ...);
-}
+/// @brief TypeList 的元素数量
+template <typename List> struct Size;
+template <typename... Ts>
+struct Size<TypeList<Ts...>> : std::integral_constant<size_t, sizeof...(Ts)> {};
+template <typename List> inline constexpr size_t Size_v = Size<List>::value;
 
-/**
- * @brief 便捷函数：运行时获取 Tuple 元素
- * @tparam Tuple Tuple 类型
- * @tparam Fn 函数对象类型
- * @param i 索引
- * @param t Tuple 实例
- * @param f 要调用的函数
- */
-template <typename Tuple, typename Fn>
-constexpr void runtime_get(size_t i, Tuple &&t, Fn &&f) {
-  tuple_switch(i, std::forward<Tuple>(t), std::forward<Fn>(f),
-               std::make_index_sequence<
-                   std::tuple_size_v<std::remove_reference_t<Tuple>>>{});
-}
+/// @brief TypeList 的第一个元素
+template <typename List> struct Front;
+template <typename T, typename... Ts> struct Front<TypeList<T, Ts...>> {
+  using type = T;
+};
+template <typename List> using Front_t = typename Front<List>::type;
 
 // --- ConnectionMonitor 检测工具 ---
 
@@ -122,34 +106,96 @@ template <typename T>
 struct IsConnectionMonitor
     : std::bool_constant<ConnectionMonitorConcept<T> && !IsPacketType<T>> {};
 
-// 从模板参数中提取 Monitor 和 Packets
-template <typename... Args> struct ExtractMonitorAndPackets;
+/**
+ * @brief 检查类型是否是 Parser 缓冲区策略
+ *
+ * 缓冲区策略需提供 `template <size_t N> using buffer_type` 与
+ * `static constexpr bool parse_on_write`。
+ *
+ * @tparam T 要检查的类型
+ */
+template <typename T>
+concept IsBufferPolicy = !IsPacketType<T> && requires {
+  typename T::template buffer_type<64>;
+  { T::parse_on_write } -> std::convertible_to<bool>;
+};
+
+/**
+ * @brief 检查缓冲区策略是否保证可读数据始终连续
+ *
+ * 策略可选地提供 `static constexpr bool contiguous_reads`，
+ * 为 true 时 get_read_spans() 的第二个 span 恒为空。
+ *
+ * @tparam B 缓冲区策略类型
+ */
+template <typename B>
+inline constexpr bool has_contiguous_reads = [] {
+  if constexpr (requires { B::contiguous_reads; })
+    return static_cast<bool>(B::contiguous_reads);
+  else
+    return false;
+}();
 
-// 第一个参数是 ConnectionMonitor
-template <typename M, typename... Ps>
-  requires IsConnectionMonitor<M>::value
-struct ExtractMonitorAndPackets<M, Ps...> {
+/**
+ * @brief 从模板参数中提取的 Parser 配置
+ * @tparam M ConnectionMonitor 类型
+ * @tparam B 缓冲区策略类型
+ * @tparam Ps 数据包类型
+ */
+template <typename M, typename B, typename... Ps> struct ParserConfig {
   using Monitor = M;
+  using BufferPolicy = B;
   using Packets = TypeList<Ps...>;
 };
 
-// 第一个参数不是 ConnectionMonitor (全部是 Packet)
-template <typename... Ps>
-  requires(
-      sizeof...(Ps) > 0 &&
-      !IsConnectionMonitor<std::tuple_element_t<0, std::tuple<Ps...>>>::value)
-struct ExtractMonitorAndPackets<Ps...> {
-  using Monitor = NullConnectionMonitor;
-  using Packets = TypeList<Ps...>;
-};
+// 从模板参数中提取 Monitor、缓冲区策略和 Packets
+// 策略参数 (ConnectionMonitor / 缓冲区策略) 可以以任意顺序出现在数据包之前
+template <typename Config, typename... Args> struct ExtractPolicies;
 
-// 空参数列表
-template <> struct ExtractMonitorAndPackets<> {
-  using Monitor = NullConnectionMonitor;
-  using Packets = TypeList<>;
+// 剩余参数全部是 Packet (或为空)
+template <typename M, typename B, typename... Ps>
+struct ExtractPolicies<ParserConfig<M, B>, Ps...> {
+  using type = ParserConfig<M, B, Ps...>;
 };
+
+// 下一个参数是 ConnectionMonitor
+template <typename M, typename B, typename First, typename... Rest>
+  requires IsConnectionMonitor<First>::value
+struct ExtractPolicies<ParserConfig<M, B>, First, Rest...>
+    : ExtractPolicies<ParserConfig<First, B>, Rest...> {};
+
+// 下一个参数是缓冲区策略
+template <typename M, typename B, typename First, typename... Rest>
+  requires(IsBufferPolicy<First> && !IsConnectionMonitor<First>::value)
+struct ExtractPolicies<ParserConfig<M, B>, First, Rest...>
+    : ExtractPolicies<ParserConfig<M, First>, Rest...> {};
+
+template <typename... Args>
+using ExtractMonitorAndPackets = typename ExtractPolicies<
+    ParserConfig<NullConnectionMonitor, Containers::BipBufferPolicy>,
+    Args...>::type;
 } // namespace Details
 
+/**
+ * @brief 帧索引项
+ *
+ * Parser::scan_frames() 的输出，描述输入数据中的一个帧。
+ */
+struct FrameInfo {
+  size_t offset;   ///< 帧起始字节在输入数据中的偏移量
+  uint32_t length; ///< 完整帧长度（帧头 + 负载 + 帧尾）
+  uint16_t cmd;    ///< 命令码
+  bool crc_ok;     ///< 帧 CRC 是否通过
+};
+
+/**
+ * @brief Parser::scan_frames() 的结果
+ */
+struct ScanResult {
+  size_t frames;   ///< 写入输出数组的帧数
+  size_t consumed; ///< 已处理的字节数，下一次扫描应从此处继续
+};
+
 /**
  * @brief 解析器类
  *
@@ -161,6 +207,8 @@ template <> struct ExtractMonitorAndPackets<> {
  *              - 仅数据包类型: Parser<PacketA, PacketB>
  *              - ConnectionMonitor + 数据包类型: Parser<Monitor, PacketA,
  * PacketB>
+ *              - 缓冲区策略 (+ ConnectionMonitor) + 数据包类型:
+ *                Parser<Containers::SpscBipBufferPolicy, Monitor, PacketA>
  *
  * @code
  * // 方式1: 无监控 (零开销)
@@ -177,12 +225,22 @@ template <> struct ExtractMonitorAndPackets<> {
  * if (!parser.get_connection_monitor().is_connected(100)) {
  *     // 超过 100ms 未收到数据
  * }
+ *
+ * // 方式3: 中断只提交数据，工作线程解析
+ * RPL::Parser<RPL::Containers::SpscBipBufferPolicy, SampleA, SampleB>
+ *     spsc_parser{deserializer};
+ *
+ * // 方式4: Linux 主机使用镜像环形缓冲区，帧数据始终连续
+ * // (需 #include <RPL/Containers/MirroredBuffer.hpp>)
+ * RPL::Parser<RPL::Containers::MirroredBufferPolicy, SampleA, SampleB>
+ *     mirrored_parser{deserializer};
  * @endcode
  */
 template <typename... Args> class Parser {
   // 提取 Monitor 和 Packet 类型
   using Extracted = Details::ExtractMonitorAndPackets<Args...>;
   using MonitorType = typename Extracted::Monitor;
+  using BufferPolicy = typename Extracted::BufferPolicy;
 
   // 从 TypeList 展开 Packet 类型的辅助模板
   template <typename PacketList> struct ParserImpl;
@@ -209,15 +267,9 @@ template <typename... Args> class Parser {
     };
 
     // --- 生成去重后的 Worker 列表 ---
-    template <typename TypeList> struct TupleFromList;
-    template <typename... Ws> struct TupleFromList<Details::TypeList<Ws...>> {
-      using type = std::tuple<Ws...>;
-    };
-
     using AllWorkers = Details::TypeList<typename GetWorker<Ts>::type...>;
     using UniqueWorkers =
         Details::UniqueTypes_t<typename GetWorker<Ts>::type...>;
-    using WorkerTuple = typename TupleFromList<UniqueWorkers>::type;
 
     // --- 编译期计算 Max Frame Size ---
     static constexpr size_t calculate_max_frame_size() {
@@ -226,6 +278,9 @@ template <typename... Args> class Parser {
         using P = typename Meta::PacketTraits<T>::Protocol;
         size_t size =
             P::header_size + Meta::PacketTraits<T>::size + P::tail_size;
+        // 子数据包承载在父负载中，帧内还包含 sub_header_size 字节
+        if constexpr (Meta::IsSubPacket<Meta::PacketTraits<T>>)
+          size += Meta::PacketTraits<T>::sub_header_size;
         if (size > max)
           max = size;
       };
@@ -235,6 +290,10 @@ template <typename... Args> class Parser {
 
     static constexpr size_t max_frame_size = calculate_max_frame_size();
 
+    /// @brief 所有协议中最大的帧头长度
+    static constexpr size_t max_header_size =
+        std::max({Meta::PacketTraits<Ts>::Protocol::header_size...});
+
     // --- 计算 Buffer Size ---
     static consteval size_t calculate_buffer_size() {
       constexpr size_t min_size = max_frame_size * 4;
@@ -282,27 +341,37 @@ template <typename... Args> class Parser {
       return count == 1 ? first_sb : 0xFF;
     }();
 
-    static constexpr bool has_multiple_start_bytes = []() {
+    static constexpr size_t start_byte_count = []() {
       size_t count = 0;
       for (int i = 0; i < 256; ++i) {
         if (header_lut[i] != 0xFF)
           count++;
       }
-      return count > 1;
+      return count;
     }();
 
+    static constexpr bool has_multiple_start_bytes = start_byte_count > 1;
+
+    /// @brief 已注册的起始字节集合（供 SIMD 扫描器使用）
+    static constexpr auto start_bytes =
+        Detail::start_bytes_from_lut<start_byte_count>(header_lut);
+
     using DeserializerType = Deserializer<Ts...>;
+    using Collector = Meta::PacketInfoCollector<Ts...>;
+    static constexpr size_t packet_count = sizeof...(Ts);
   };
 
   using Impl = ParserImpl<typename Extracted::Packets>;
-  using WorkerTuple = typename Impl::WorkerTuple;
   using UniqueWorkers = typename Impl::UniqueWorkers;
+  static constexpr size_t worker_count = Details::Size_v<UniqueWorkers>;
 
   static constexpr size_t max_frame_size = Impl::max_frame_size;
+  static constexpr size_t max_header_size = Impl::max_header_size;
   static constexpr size_t buffer_size = Impl::buffer_size;
   static constexpr auto &header_lut = Impl::header_lut;
   static constexpr uint8_t unique_start_byte = Impl::unique_start_byte;
   static constexpr bool has_multiple_start_bytes = Impl::has_multiple_start_bytes;
+  static constexpr auto start_bytes = Impl::start_bytes;
 
   // 从 Packets TypeList 中提取 Deserializer 类型
   template <typename PacketList> struct DeserializerFromPackets;
@@ -313,6 +382,28 @@ template <typename... Args> class Parser {
 
   using DeserializerType =
       typename DeserializerFromPackets<typename Extracted::Packets>::type;
+  using Collector = typename Impl::Collector;
+
+  /**
+   * @brief 类型擦除的回调槽位
+   *
+   * invoke 是按数据包类型实例化的跳板函数，负责把 fn 还原为
+   * PacketHandler<T> 并构造 PacketView<T>。
+   */
+  struct HandlerSlot {
+    void (*invoke)(const HandlerSlot &, std::span<const uint8_t>,
+                   std::span<const uint8_t>) = nullptr;
+    void (*fn)() = nullptr;
+    void *user = nullptr;
+  };
+
+  template <typename T>
+  static void invoke_handler(const HandlerSlot &slot,
+                             std::span<const uint8_t> s1,
+                             std::span<const uint8_t> s2) {
+    reinterpret_cast<PacketHandler<T>>(slot.fn)(PacketView<T>{s1, s2},
+                                                 slot.user);
+  }
 
   /**
    * @brief 解析结果枚举
@@ -325,14 +416,148 @@ template <typename... Args> class Parser {
     Incomplete  ///< 数据不完整，需要等待更多数据
   };
 
+  /// @brief 缓冲区是否保证可读数据始终连续（编译期移除回绕处理）
+  static constexpr bool contiguous_reads =
+      Details::has_contiguous_reads<BufferPolicy>;
+
   // --- 成员变量 ---
-  Containers::BipBuffer<buffer_size> buffer;
+  typename BufferPolicy::template buffer_type<buffer_size> buffer;
   DeserializerType &deserializer;
   [[no_unique_address]] MonitorType monitor_{};
+  std::array<HandlerSlot, Impl::packet_count> handlers_{}; ///< 按序列索引存放的回调
+  size_t handler_count_{0}; ///< 已注册的回调数量，为 0 时跳过分发
+  /// @brief 整帧旁路回调，见 set_frame_tap()
+  void (*frame_tap_)(uint16_t, std::span<const uint8_t>,
+                     std::span<const uint8_t>, void *){nullptr};
+  void *frame_tap_user_{nullptr};
+  /// @brief 原始字节旁路回调，见 set_raw_tap()
+  void (*raw_tap_)(std::span<const uint8_t>, bool, void *){nullptr};
+  void *raw_tap_user_{nullptr};
+  uint8_t *raw_tap_write_{nullptr}; ///< 最近一次 get_write_buffer() 的起点
+
+  /**
+   * @brief 未接收完整的帧的解析进度
+   *
+   * 帧头已通过校验但数据尚未到齐时记录下来，下次解析直接从 covered 处
+   * 继续计算帧 CRC，无论数据被拆成多少块到达，每个字节只参与一次 CRC。
+   * 仅在缓冲区读位置仍停留在该帧起始处时有效。
+   */
+  struct PendingFrame {
+    size_t data_len = 0;  ///< 负载长度
+    size_t covered = 0;   ///< 已计算 CRC 的字节数（从帧起始处算起）
+    uint16_t cmd_id = 0;  ///< 命令码
+    uint16_t crc = 0;     ///< 前 covered 字节的 CRC 中间值
+    bool active = false;  ///< 帧头是否已校验
+  };
+  PendingFrame pending_{};
+  size_t failure_skip_{1}; ///< 上一次 Failure 之后应丢弃的字节数
 
 public:
+  /**
+   * @brief 数据包回调函数类型
+   *
+   * @tparam T 数据包类型
+   * 参数依次为负载零拷贝视图与注册时传入的 user 指针。
+   * 无捕获的 lambda 可直接隐式转换为此类型。
+   */
+  template <typename T>
+  using PacketHandler = void (*)(const PacketView<T> &, void *);
+
   explicit Parser(DeserializerType &des) : deserializer(des) {}
 
+  /**
+   * @brief 注册数据包回调
+   *
+   * 每当一个 T 类型的帧通过校验并写入 Deserializer 后，在解析路径上
+   * 同步调用 fn。适用于 HurtData、ShootData 等事件型数据包，
+   * 避免轮询时被后续帧覆盖。每个类型最多注册一个回调，重复注册会替换。
+   *
+   * @tparam T 数据包类型（必须是此 Parser 注册的数据包）
+   * @param fn 回调函数，传入 nullptr 等同于 off<T>()
+   * @param user 原样传给回调的用户指针
+   *
+   * @note 回调运行在调用 push_data() / advance_write_index() /
+   *       try_parse_packets() 的上下文中（可能是中断），应尽量简短
+   * @note 长度被 LengthPolicy::Reject 拒绝的帧不会触发回调
+   */
+  template <typename T>
+    requires Details::Contains<T, typename Extracted::Packets>::value
+  void on(PacketHandler<T> fn, void *user = nullptr) noexcept {
+    auto &slot = handlers_[Collector::template type_seq_index<T>()];
+    if (!fn) {
+      off<T>();
+      return;
+    }
+    if (!slot.invoke)
+      ++handler_count_;
+    slot = {&invoke_handler<T>, reinterpret_cast<void (*)()>(fn), user};
+  }
+
+  /**
+   * @brief 注销数据包回调
+   * @tparam T 数据包类型
+   */
+  template <typename T>
+    requires Details::Contains<T, typename Extracted::Packets>::value
+  void off() noexcept {
+    auto &slot = handlers_[Collector::template type_seq_index<T>()];
+    if (slot.invoke)
+      --handler_count_;
+    slot = {};
+  }
+
+  /**
+   * @brief 整帧旁路回调函数类型
+   *
+   * 参数依次为命令码、完整帧（帧头 + 负载 + 帧尾，跨越缓冲区边界时分为两段）
+   * 与注册时传入的 user 指针。
+   */
+  using FrameTap = void (*)(uint16_t cmd, std::span<const uint8_t> s1,
+                            std::span<const uint8_t> s2, void *user);
+
+  /**
+   * @brief 设置整帧旁路回调
+   *
+   * 每个通过帧 CRC 校验的帧在丢弃前都会以原始字节交给 fn，
+   * 不论其命令码是否注册、长度是否被 LengthPolicy 拒绝。
+   * 用于录制（见 Host/Capture.hpp）或转发。未设置时只有一次分支判断。
+   *
+   * @param fn 回调函数，传入 nullptr 取消
+   * @param user 原样传给回调的用户指针
+   * @note 与 on() 的回调运行在相同的上下文中
+   */
+  void set_frame_tap(FrameTap fn, void *user = nullptr) noexcept {
+    frame_tap_ = fn;
+    frame_tap_user_ = fn ? user : nullptr;
+  }
+
+  /**
+   * @brief 原始字节旁路回调函数类型
+   *
+   * 参数依次为写入的字节、是否被缓冲区接收（false 表示溢出被整块丢弃）
+   * 与注册时传入的 user 指针。
+   */
+  using RawTap = void (*)(std::span<const uint8_t> data, bool accepted,
+                          void *user);
+
+  /**
+   * @brief 设置原始字节旁路回调
+   *
+   * push_data() 的每块数据、以及经 get_write_buffer() /
+   * advance_write_index() 提交的每段数据（DMA 路径），在解析之前
+   * 都会交给 fn。用于录制原始串口流（见 Host/Capture.hpp）。
+   * 未设置时只有一次分支判断。
+   *
+   * @param fn 回调函数，传入 nullptr 取消
+   * @param user 原样传给回调的用户指针
+   * @note 运行在调用 push_data() / advance_write_index() 的上下文中，
+   *       对 parse_on_write 为 false 的策略即生产者（中断）上下文
+   */
+  void set_raw_tap(RawTap fn, void *user = nullptr) noexcept {
+    raw_tap_ = fn;
+    raw_tap_user_ = fn ? user : nullptr;
+  }
+
   /**
    * @brief 获取连接监控器引用
    *
@@ -358,14 +583,21 @@ public:
    * @param data 指向输入数据的指针
    * @param length 数据长度
    * @return void 或错误（缓冲区溢出）
+   * @note 缓冲区策略的 parse_on_write 为 false 时只写入数据，不执行解析
    */
   tl::expected<void, Error> push_data(const uint8_t *data,
                                       const size_t length) {
-    if (!buffer.write(data, length)) {
+    const bool accepted = buffer.write(data, length);
+    if (raw_tap_) [[unlikely]]
+      raw_tap_({data, length}, accepted, raw_tap_user_);
+    if (!accepted) {
       return tl::unexpected(
           Error{ErrorCode::BufferOverflow, "Buffer overflow"});
     }
-    return try_parse_packets();
+    if constexpr (BufferPolicy::parse_on_write)
+      return try_parse_packets();
+    else
+      return {};
   }
 
   /**
@@ -377,7 +609,10 @@ public:
    * @return 可写入的连续内存 span
    */
   std::span<uint8_t> get_write_buffer() noexcept {
-    return buffer.get_write_buffer();
+    const auto span = buffer.get_write_buffer();
+    if (raw_tap_) [[unlikely]]
+      raw_tap_write_ = span.data();
+    return span;
   }
 
   /**
@@ -388,13 +623,22 @@ public:
    *
    * @param length 已写入的字节数
    * @return void 或错误（提交长度无效）
+   * @note 缓冲区策略的 parse_on_write 为 false 时只提交数据，不执行解析，
+   *       可在中断中调用，由其他线程调用 try_parse_packets()
    */
   tl::expected<void, Error> advance_write_index(size_t length) {
     if (!buffer.advance_write_index(length)) {
       return tl::unexpected(
           Error{ErrorCode::BufferOverflow, "Invalid advance length"});
     }
-    return try_parse_packets();
+    if (raw_tap_ && raw_tap_write_) [[unlikely]] {
+      raw_tap_({raw_tap_write_, length}, true, raw_tap_user_);
+      raw_tap_write_ += length;
+    }
+    if constexpr (BufferPolicy::parse_on_write)
+      return try_parse_packets();
+    else
+      return {};
   }
 
   /**
@@ -425,7 +669,10 @@ public:
    * @brief 清空缓冲区
    * 丢弃所有未处理的数据
    */
-  void clear_buffer() noexcept { buffer.clear(); }
+  void clear_buffer() noexcept {
+    buffer.clear();
+    pending_ = {};
+  }
 
   /**
    * @brief 尝试解析缓冲区中的数据包
@@ -463,29 +710,31 @@ public:
           scan_offset = static_cast<size_t>(next_sb - data_ptr);
           worker_idx = header_lut[unique_start_byte];
         } else {
-          // 优化多起始字节扫描
-          while (scan_offset < view_size &&
-                 (worker_idx = header_lut[data_ptr[scan_offset]]) == 0xFF) {
-            scan_offset++;
-          }
+          // 多起始字节：SIMD 一次比较 16 字节
+          scan_offset += Detail::find_first_start_byte<start_bytes>(
+              data_ptr + scan_offset, view_size - scan_offset, header_lut);
           if (scan_offset >= view_size)
             break;
+          worker_idx = header_lut[data_ptr[scan_offset]];
         }
 
         // 找到潜在帧头，丢弃之前的垃圾数据
         if (scan_offset > 0) {
           buffer.discard(scan_offset);
-          available_bytes -= scan_offset;
+          available_bytes = buffer.available();
+          pending_ = {};
         }
 
         ParseResult result = ParseResult::Incomplete;
 
-        // 使用 tuple_switch 动态分发到编译期生成的 Worker
-        Details::runtime_get(worker_idx, WorkerTuple{},
-                             [&](auto worker_instance) {
-                               using WorkerType = decltype(worker_instance);
-                               result = this->parse_frame_impl<WorkerType>();
-                             });
+        // 通过编译期生成的跳转表分发到对应的 Worker（只有一个时直接调用）
+        if constexpr (worker_count == 1)
+          result = parse_frame_impl<Details::Front_t<UniqueWorkers>>();
+        else
+          result = worker_entry(worker_idx).parse(*this);
+
+        if (result != ParseResult::Incomplete)
+          pending_ = {};
 
         if (result == ParseResult::Success) {
           monitor_.on_packet_received();
@@ -493,9 +742,10 @@ public:
           frame_handled = true;
           break;
         } else if (result == ParseResult::Failure) {
-          // 失败，丢弃起始字节，继续扫描
-          buffer.discard(1);
-          available_bytes--;
+          // 失败，丢弃起始字节（帧 CRC 失败时跳到下一个候选帧头），继续扫描
+          buffer.discard(failure_skip_);
+          available_bytes = buffer.available();
+          failure_skip_ = 1;
           frame_handled = true;
           break;
         } else {
@@ -507,7 +757,8 @@ public:
       if (!frame_handled) {
         if (scan_offset == view_size) {
           buffer.discard(view_size);
-          available_bytes -= view_size;
+          available_bytes = buffer.available();
+          pending_ = {};
         }
         if (available_bytes == 0)
           break;
@@ -516,37 +767,122 @@ public:
     return {};
   }
 
-private:
-  // --- 通用帧解析实现 ---
-  template <typename Worker> ParseResult parse_frame_impl() {
-    using P = typename Worker::Protocol;
-
-    if (buffer.available() < P::header_size)
-      return ParseResult::Incomplete;
+  /**
+   * @brief 无状态批量扫描，只建立帧索引
+   *
+   * 使用与 try_parse_packets() 相同的起始字节查找、帧头校验与 Worker
+   * 跳转表扫描一段连续数据，输出每个帧的 (偏移量, 长度, 命令码, CRC 结果)，
+   * 不写入 Deserializer、不调用回调、不修改任何解析器状态，
+   * 适用于对录制的大文件建立索引。
+   *
+   * 帧 CRC 校验失败的帧同样输出（crc_ok = false），之后从其下一个字节继续扫描。
+   * 数据末尾不完整的帧不输出，consumed 停在该帧起始处，
+   * 调用方可把剩余数据与下一块拼接后继续扫描。
+   *
+   * @param data 输入数据
+   * @param out 输出帧索引数组，写满后提前返回
+   * @param start_limit 只输出起始于 [0, start_limit) 的帧（帧本身可以超出），
+   *                    用于把大文件分块交给多个线程；最后一帧越过
+   *                    start_limit 时 consumed 为该帧结束位置
+   * @return 输出帧数与已处理的字节数
+   *
+   * @par 使用示例
+   * @code
+   * std::vector<RPL::FrameInfo> index(capture.size() / 16);
+   * auto [frames, consumed] =
+   *     RPL::Parser<SampleA, SampleB>::scan_frames(capture, index);
+   * index.resize(frames);
+   * @endcode
+   */
+  static ScanResult scan_frames(std::span<const uint8_t> data,
+                                std::span<FrameInfo> out,
+                                size_t start_limit = SIZE_MAX) noexcept {
+    const size_t limit = std::min(start_limit, data.size());
+    size_t pos = 0;
+    size_t count = 0;
+    while (count < out.size() && pos < limit) {
+      pos += find_start_byte(data.subspan(pos, limit - pos));
+      if (pos >= limit)
+        break;
+
+      const WorkerEntry &worker = worker_entry(header_lut[data[pos]]);
+      const FrameProbe probe =
+          worker.probe(data.data() + pos, data.size() - pos);
+      if (probe.result == ParseResult::Incomplete)
+        break;
+      if (probe.result == ParseResult::Failure) {
+        ++pos;
+        continue;
+      }
+      out[count++] = FrameInfo{pos, static_cast<uint32_t>(probe.length),
+                               probe.cmd, probe.crc_ok};
+      pos += probe.crc_ok ? probe.length : 1;
+    }
+    return {count, std::min(pos, data.size())};
+  }
 
-    // 获取帧头指针，尽量避免拷贝
-    uint8_t header_stack_copy[P::header_size];
-    const uint8_t *header_ptr = nullptr;
-    auto [hs1, hs2] = buffer.get_read_spans(0, P::header_size);
-    if (hs2.empty()) {
-      header_ptr = hs1.data();
-    } else {
-      buffer.peek(header_stack_copy, 0, P::header_size);
-      header_ptr = header_stack_copy;
+private:
+  /**
+   * @brief 将成功写入的数据包分发给已注册的回调
+   *
+   * 只分发 Deserializer 实际写入的表项：长度被拒绝的父数据包或子数据包
+   * 不会触发回调。没有注册任何回调时只有一次分支判断。
+   *
+   * @param written Deserializer::write_entries() 的结果
+   * @param s1 父负载第一段
+   * @param s2 父负载第二段
+   */
+  void dispatch(const typename DeserializerType::WrittenEntries &written,
+                std::span<const uint8_t> s1, std::span<const uint8_t> s2) {
+    if (handler_count_ == 0) [[likely]]
+      return;
+    if (written.parent) {
+      const auto &slot = handlers_[written.parent->seq];
+      if (slot.invoke)
+        slot.invoke(slot, s1, s2);
     }
+    if constexpr (Collector::has_sub_packets) {
+      if (written.sub) {
+        const auto &slot = handlers_[written.sub->seq];
+        if (slot.invoke)
+          slot.invoke(slot, written.sub_s1, written.sub_s2);
+      }
+    }
+  }
 
+  /**
+   * @brief 校验帧头（第二起始字节与帧头 CRC）
+   * @tparam P 协议类型
+   * @param header_ptr 指向完整帧头
+   */
+  template <typename P>
+  static bool header_valid(const uint8_t *header_ptr) noexcept {
     if constexpr (P::has_second_byte) {
       if (header_ptr[1] != P::second_byte)
-        return ParseResult::Failure;
+        return false;
     }
-
     if constexpr (P::has_header_crc) {
-      if (RPL::ProtocolCRC8::calc(header_ptr, 4) != header_ptr[4])
-        return ParseResult::Failure;
+      if (Meta::HeaderCRC_t<P>::calc(header_ptr, 4) != header_ptr[4])
+        return false;
     }
+    return true;
+  }
 
-    size_t data_len = 0;
-    uint16_t cmd_id = 0;
+  /**
+   * @brief 校验帧头并读取负载长度与命令码
+   *
+   * @tparam Worker Worker 类型
+   * @param header_ptr 指向完整帧头
+   * @param data_len 输出负载长度
+   * @param cmd_id 输出命令码
+   * @return false 如果帧头校验失败或负载长度超出上限
+   */
+  template <typename Worker>
+  static bool read_header(const uint8_t *header_ptr, size_t &data_len,
+                          uint16_t &cmd_id) noexcept {
+    using P = typename Worker::Protocol;
+    if (!header_valid<P>(header_ptr))
+      return false;
 
     if constexpr (Worker::is_fixed) {
       data_len = Worker::fixed_size;
@@ -561,24 +897,229 @@ private:
         std::memcpy(&cmd_id, header_ptr + P::cmd_offset, 2);
       }
       if (data_len > max_frame_size - P::header_size - P::tail_size)
+        return false;
+    }
+    return true;
+  }
+
+  /// @brief probe_frame() 的结果
+  struct FrameProbe {
+    ParseResult result; ///< Success 表示帧完整（CRC 结果见 crc_ok）
+    size_t length;      ///< 完整帧长度
+    uint16_t cmd;       ///< 命令码
+    bool crc_ok;        ///< 帧 CRC 是否通过
+  };
+
+  /**
+   * @brief 检查连续内存中以起始字节开头的一个帧（无状态）
+   *
+   * @tparam Worker Worker 类型
+   * @param frame 指向起始字节
+   * @param size 从起始字节到数据末尾的字节数
+   */
+  template <typename Worker>
+  static FrameProbe probe_frame(const uint8_t *frame, size_t size) noexcept {
+    using P = typename Worker::Protocol;
+    if (size < P::header_size)
+      return {ParseResult::Incomplete, 0, 0, false};
+
+    size_t data_len = 0;
+    uint16_t cmd_id = 0;
+    if (!read_header<Worker>(frame, data_len, cmd_id))
+      return {ParseResult::Failure, 0, 0, false};
+
+    const size_t calc_len = P::header_size + data_len;
+    const size_t total_len = calc_len + P::tail_size;
+    if (size < total_len)
+      return {ParseResult::Incomplete, 0, 0, false};
+
+    uint16_t recv_crc = 0;
+    std::memcpy(&recv_crc, frame + calc_len, 2);
+    const bool crc_ok = P::RPL_CRC::calc(frame, calc_len) == recv_crc;
+    return {ParseResult::Success, total_len, cmd_id, crc_ok};
+  }
+
+  /**
+   * @brief Worker 跳转表项
+   *
+   * 每个去重后的 Worker 一项，按 header_lut 中的索引排列。
+   */
+  struct WorkerEntry {
+    ParseResult (*parse)(Parser &);          ///< 调用 parse_frame_impl<W>
+    bool (*header_valid)(const uint8_t *);   ///< header_valid<W::Protocol>
+    FrameProbe (*probe)(const uint8_t *, size_t); ///< probe_frame<W>
+    size_t header_size;                      ///< W::Protocol::header_size
+  };
+
+  /**
+   * @brief 获取 Worker 跳转表项
+   *
+   * 跳转表在编译期生成，分发只需一次索引与一次间接调用，
+   * 与注册的协议数量无关。
+   *
+   * @param worker_idx header_lut 中的 Worker 索引
+   */
+  static const WorkerEntry &worker_entry(uint8_t worker_idx) noexcept {
+    static constexpr auto table =
+        []<typename... Ws>(Details::TypeList<Ws...>) {
+          return std::array<WorkerEntry, sizeof...(Ws)>{
+              WorkerEntry{[](Parser &self) {
+                            return self.template parse_frame_impl<Ws>();
+                          },
+                          &Parser::template header_valid<typename Ws::Protocol>,
+                          &Parser::template probe_frame<Ws>,
+                          Ws::Protocol::header_size}...};
+        }(UniqueWorkers{});
+    return table[worker_idx];
+  }
+
+  /**
+   * @brief 在一段数据中查找第一个已注册的起始字节
+   * @return 起始字节的下标，找不到时返回 seg.size()
+   */
+  static size_t find_start_byte(std::span<const uint8_t> seg) noexcept {
+    if constexpr (unique_start_byte != 0xFF) {
+      const void *hit = std::memchr(seg.data(), unique_start_byte, seg.size());
+      return hit ? static_cast<size_t>(static_cast<const uint8_t *>(hit) -
+                                       seg.data())
+                 : seg.size();
+    } else {
+      return Detail::find_first_start_byte<start_bytes>(seg.data(), seg.size(),
+                                                        header_lut);
+    }
+  }
+
+  /**
+   * @brief 帧 CRC 校验失败后的快速重同步
+   *
+   * 在失败帧的范围 [1, extent) 内查找下一个可能的帧头：起始字节已注册，
+   * 且帧头校验通过（帧头尚未到齐时保守地视为候选）。
+   * 帧头校验失败的位置本来也会逐一以 Failure 丢弃，可以一次性跳过，
+   * 避免负载中大量起始字节导致的反复扫描与分发。
+   *
+   * @param extent 失败帧的长度
+   * @return 应丢弃的字节数，至少为 1
+   */
+  size_t resync_offset(size_t extent) const noexcept {
+    const size_t limit = std::min(extent, buffer.available());
+    auto [s1, s2] = buffer.get_read_spans(0, limit);
+    size_t k = 1;
+    while (k < limit) {
+      const auto seg =
+          k < s1.size() ? s1.subspan(k) : s2.subspan(k - s1.size());
+      const size_t hit = find_start_byte(seg);
+      k += hit;
+      if (hit == seg.size())
+        continue; // 本段没有起始字节，继续查找下一段
+
+      const uint8_t sb = k < s1.size() ? s1[k] : s2[k - s1.size()];
+      const WorkerEntry &worker = worker_entry(header_lut[sb]);
+      bool candidate = true;
+      if (k + worker.header_size <= s1.size()) {
+        candidate = worker.header_valid(s1.data() + k);
+      } else if (k >= s1.size() &&
+                 k - s1.size() + worker.header_size <= s2.size()) {
+        candidate = worker.header_valid(s2.data() + (k - s1.size()));
+      } else {
+        uint8_t header[max_header_size];
+        if (buffer.peek(header, k, worker.header_size))
+          candidate = worker.header_valid(header);
+      }
+      if (candidate)
+        return k;
+      ++k;
+    }
+    return std::max<size_t>(limit, 1);
+  }
+
+  /**
+   * @brief 把帧 CRC 推进到帧起始处之后 end 字节
+   *
+   * 只计算 [pending_.covered, end) 之间新到达的字节，可能跨越两段。
+   */
+  template <typename P> void advance_crc(size_t end) noexcept {
+    if (end <= pending_.covered)
+      return;
+    auto [c1, c2] =
+        buffer.get_read_spans(pending_.covered, end - pending_.covered);
+    for (const auto seg : {c1, c2}) {
+      if (seg.empty())
+        continue;
+      pending_.crc =
+          pending_.covered == 0
+              ? P::RPL_CRC::calc(seg.data(), seg.size())
+              : P::RPL_CRC::calc(seg.data(), seg.size(), pending_.crc);
+      pending_.covered += seg.size();
+    }
+  }
+
+  // --- 通用帧解析实现 ---
+  template <typename Worker> ParseResult parse_frame_impl() {
+    using P = typename Worker::Protocol;
+
+    size_t data_len = 0;
+    uint16_t cmd_id = 0;
+
+    if (pending_.active) {
+      // 帧头已在之前的尝试中校验过
+      data_len = pending_.data_len;
+      cmd_id = pending_.cmd_id;
+    } else {
+      if (buffer.available() < P::header_size)
+        return ParseResult::Incomplete;
+
+      // 获取帧头指针，尽量避免拷贝
+      uint8_t header_stack_copy[P::header_size];
+      const uint8_t *header_ptr = nullptr;
+      if constexpr (contiguous_reads) {
+        header_ptr = buffer.get_contiguous_read_buffer().data();
+      } else {
+        auto [hs1, hs2] = buffer.get_read_spans(0, P::header_size);
+        if (hs2.empty()) {
+          header_ptr = hs1.data();
+        } else {
+          buffer.peek(header_stack_copy, 0, P::header_size);
+          header_ptr = header_stack_copy;
+        }
+      }
+
+      if (!read_header<Worker>(header_ptr, data_len, cmd_id))
         return ParseResult::Failure;
     }
 
     size_t total_len = P::header_size + data_len + P::tail_size;
-    if (buffer.available() < total_len)
+    size_t calc_len = total_len - P::tail_size;
+    const size_t available = buffer.available();
+
+    // 增量 CRC：只计算自上次尝试以来新到达的字节
+    advance_crc<P>(std::min(available, calc_len));
+    if (available < total_len) {
+      pending_.data_len = data_len;
+      pending_.cmd_id = cmd_id;
+      pending_.active = true;
       return ParseResult::Incomplete;
+    }
+    const uint16_t calc_crc = pending_.crc;
 
-    // 获取分段读视图，进行分段 CRC 校验
+    // 获取分段读视图
     auto [s1, s2] = buffer.get_read_spans(0, total_len);
 
-    size_t calc_len = total_len - P::tail_size;
-    uint16_t calc_crc = 0;
-
-    if (calc_len <= s1.size()) {
-      calc_crc = P::RPL_CRC::calc(s1.data(), calc_len);
-    } else {
-      calc_crc = P::RPL_CRC::calc(s1.data(), s1.size());
-      calc_crc = P::RPL_CRC::calc(s2.data(), calc_len - s1.size(), calc_crc);
+    if constexpr (contiguous_reads) {
+      // 缓冲区保证整帧连续：单段读取 CRC、单段拷贝
+      const uint8_t *frame = s1.data();
+      uint16_t recv_crc = 0;
+      std::memcpy(&recv_crc, frame + calc_len, 2);
+      if (calc_crc != recv_crc) {
+        failure_skip_ = resync_offset(total_len);
+        return ParseResult::Failure;
+      }
+      const std::span<const uint8_t> payload{frame + P::header_size, data_len};
+      if (const auto written = deserializer.write_entries(cmd_id, payload, {}))
+        dispatch(written, payload, {});
+      if (frame_tap_) [[unlikely]]
+        frame_tap_(cmd_id, s1, {}, frame_tap_user_);
+      buffer.discard(total_len);
+      return ParseResult::Success;
     }
 
     // 验证接收到的 CRC
@@ -593,8 +1134,10 @@ private:
           s1.data()[calc_len] | (static_cast<uint16_t>(s2.data()[0]) << 8);
     }
 
-    if (calc_crc != recv_crc)
+    if (calc_crc != recv_crc) {
+      failure_skip_ = resync_offset(total_len);
       return ParseResult::Failure;
+    }
 
     // 反序列化 (分段拷贝)
     std::span<const uint8_t> payload_s1, payload_s2;
@@ -612,7 +1155,11 @@ private:
       payload_s2 = s2.subspan(P::header_size - s1.size(), data_len);
     }
 
-    deserializer.write_segmented(cmd_id, payload_s1, payload_s2);
+    if (const auto written =
+            deserializer.write_entries(cmd_id, payload_s1, payload_s2))
+      dispatch(written, payload_s1, payload_s2);
+    if (frame_tap_) [[unlikely]]
+      frame_tap_(cmd_id, s1, s2, frame_tap_user_);
 
     // 统一丢弃
     buffer.discard(total_len);
@@ -12,10 +12,12 @@
 #define RPL_SERIALIZER_HPP
 
 #include "Meta/BitstreamSerializer.hpp"
+#include "Meta/PacketSet.hpp"
 #include "Meta/PacketTraits.hpp"
 #include "Utils/Def.hpp"
 #include "Utils/Error.hpp"
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <cstring>
 #include <optional>
@@ -41,6 +43,47 @@ namespace RPL {
 template <typename T, typename... Ts>
 concept Serializable = (std::is_same_v<std::decay_t<T>, Ts> || ...);
 
+/**
+ * @brief 分散-聚集方式序列化的单个帧
+ *
+ * 由 Serializer::serialize_scatter() 生成，帧头与帧尾保存在对象内部，
+ * 负载指向原数据包（BitLayout 数据包指向对象内部的编码结果）。
+ * 三段依次发送即为完整的帧，适用于 UART DMA 链表描述符或 writev。
+ *
+ * @tparam T 数据包类型
+ *
+ * @warning 负载段引用原数据包，发送完成前不得修改或销毁该数据包；
+ *          segments() 返回的 span 引用本对象，对象移动后需重新获取
+ */
+template <typename T> struct ScatterFrame {
+  using Traits = Meta::PacketTraits<T>;
+  using Protocol = typename Traits::Protocol;
+
+  /// @brief 帧由几段组成
+  static constexpr size_t segment_count = 3;
+
+  std::array<uint8_t, Protocol::header_size> header{}; ///< 帧头
+  std::array<uint8_t, Protocol::tail_size> tail{};     ///< 帧尾 CRC
+  /// @brief 位流编码结果（仅 BitLayout 数据包使用）
+  std::array<uint8_t, Meta::HasBitLayout<Traits> ? Traits::size : 0> encoded{};
+  const uint8_t *payload{nullptr}; ///< 负载起始地址（BitLayout 数据包不使用）
+
+  /// @brief 获取 (帧头, 负载, 帧尾) 三段
+  [[nodiscard]] std::array<std::span<const uint8_t>, segment_count>
+  segments() const noexcept {
+    const uint8_t *data =
+        Meta::HasBitLayout<Traits> ? encoded.data() : payload;
+    return {std::span<const uint8_t>(header),
+            std::span<const uint8_t>(data, Traits::size),
+            std::span<const uint8_t>(tail)};
+  }
+
+  /// @brief 完整帧的字节数
+  static constexpr size_t size() noexcept {
+    return Protocol::header_size + Traits::size + Protocol::tail_size;
+  }
+};
+
 /**
  * @brief 序列化器类
  *
@@ -70,6 +113,13 @@ concept Serializable = (std::is_same_v<std::decay_t<T>, Ts> || ...);
  * - 帧尾（Frame CRC16）
  */
 template <typename... Ts> class Serializer {
+  static_assert(!(Meta::IsSubPacket<Meta::PacketTraits<Ts>> || ...),
+                "Sub packets are receive-only; serialize the parent packet "
+                "(e.g. RobotInteractionData) instead");
+  static_assert((Meta::is_transmittable_v<Ts> && ...),
+                "Direction::Rx packets cannot be serialized; use "
+                "Meta::PacketSet<...>::Tx to build the transmit set");
+
 public:
   /**
    * @brief 将数据包序列化到用户提供的缓冲区
@@ -101,61 +151,11 @@ public:
     auto serialize_one = [&]<typename T>(const T &packet) {
       using DecayedT = std::decay_t<T>;
       using Protocol = typename Meta::PacketTraits<DecayedT>::Protocol;
-      constexpr uint16_t cmd = Meta::PacketTraits<DecayedT>::cmd;
       constexpr size_t data_size = Meta::PacketTraits<DecayedT>::size;
       constexpr size_t current_frame_size = frame_size<DecayedT>();
 
       uint8_t *current_buffer = buffer + offset;
-
-      // 帧头 (起始字节)
-      current_buffer[0] = Protocol::start_byte;
-      if constexpr (Protocol::has_second_byte) {
-        current_buffer[1] = Protocol::second_byte;
-      }
-
-      // 长度字段
-      if constexpr (Protocol::has_length_field) {
-        const auto data_size_u16 = static_cast<uint16_t>(data_size);
-        // 长度字段采用小端格式
-        if constexpr (Protocol::length_field_bytes == 1) {
-          current_buffer[Protocol::length_offset] =
-              static_cast<uint8_t>(data_size_u16 & 0xFF);
-        } else {
-          current_buffer[Protocol::length_offset] =
-              static_cast<uint8_t>(data_size_u16 & 0xFF);
-          current_buffer[Protocol::length_offset + 1] =
-              static_cast<uint8_t>((data_size_u16 >> 8) & 0xFF);
-        }
-      }
-
-      // Sequence 字段
-      if constexpr (requires { Protocol::has_seq_field; }) {
-        if constexpr (Protocol::has_seq_field) {
-          current_buffer[Protocol::seq_offset] = m_Sequence;
-        }
-      }
-
-      // 帧头 CRC
-      if constexpr (Protocol::has_header_crc) {
-        // CRC8 覆盖从 0 到 header_crc_offset 的字节
-        const uint8_t header_crc8 =
-            ProtocolCRC8::calc(current_buffer, Protocol::header_crc_offset);
-        current_buffer[Protocol::header_crc_offset] = header_crc8;
-      }
-
-      // 命令 ID 字段
-      if constexpr (Protocol::has_cmd_field) {
-        // 命令字段采用小端格式
-        if constexpr (Protocol::cmd_field_bytes == 1) {
-          current_buffer[Protocol::cmd_offset] =
-              static_cast<uint8_t>(cmd & 0xFF);
-        } else {
-          current_buffer[Protocol::cmd_offset] =
-              static_cast<uint8_t>(cmd & 0xFF);
-          current_buffer[Protocol::cmd_offset + 1] =
-              static_cast<uint8_t>((cmd >> 8) & 0xFF);
-        }
-      }
+      write_header<DecayedT>(current_buffer);
 
       // Data Payload
       if constexpr (Meta::HasBitLayout<Meta::PacketTraits<DecayedT>>) {
@@ -173,12 +173,8 @@ public:
       using FrameCRC = typename Protocol::RPL_CRC;
       const uint16_t frame_crc16 =
           FrameCRC::calc(current_buffer, Protocol::header_size + data_size);
-
-      // CRC16 采用小端格式
-      current_buffer[Protocol::header_size + data_size] =
-          static_cast<uint8_t>(frame_crc16 & 0xFF);
-      current_buffer[Protocol::header_size + data_size + 1] =
-          static_cast<uint8_t>((frame_crc16 >> 8) & 0xFF);
+      write_tail(current_buffer + Protocol::header_size + data_size,
+                 frame_crc16);
 
       offset += current_frame_size;
     };
@@ -188,6 +184,55 @@ public:
     return offset;
   }
 
+  /**
+   * @brief 以分散-聚集方式序列化单个数据包
+   *
+   * 只生成帧头与帧尾，负载直接引用 packet 本身（BitLayout 数据包除外，
+   * 其位流编码结果保存在返回的帧对象中）。帧 CRC 依次覆盖帧头与负载两段，
+   * 不需要把负载拷贝到连续缓冲区。序列号随每次调用递增。
+   *
+   * @tparam T 数据包类型
+   * @param packet 要发送的数据包，在帧发送完成前必须保持有效且不被修改
+   * @return 帧对象，通过 segments() 获取 (帧头, 负载, 帧尾) 三段
+   *
+   * @par 使用示例
+   * @code
+   * auto frame = serializer.serialize_scatter(interaction_data);
+   * const auto segs = frame.segments();
+   * iovec iov[3];
+   * for (size_t i = 0; i < segs.size(); ++i)
+   *     iov[i] = {const_cast<uint8_t *>(segs[i].data()), segs[i].size()};
+   * writev(fd, iov, 3);
+   * @endcode
+   */
+  template <typename T>
+    requires Serializable<T, Ts...>
+  [[nodiscard]] ScatterFrame<std::decay_t<T>>
+  serialize_scatter(const T &packet) noexcept {
+    using DecayedT = std::decay_t<T>;
+    using Protocol = typename Meta::PacketTraits<DecayedT>::Protocol;
+    using FrameCRC = typename Protocol::RPL_CRC;
+    constexpr size_t data_size = Meta::PacketTraits<DecayedT>::size;
+
+    ScatterFrame<DecayedT> frame;
+    write_header<DecayedT>(frame.header.data());
+    if constexpr (Meta::HasBitLayout<Meta::PacketTraits<DecayedT>>) {
+      serialize_bitstream<DecayedT>(
+          std::span<uint8_t>(frame.encoded.data(), data_size), packet);
+    } else {
+      frame.payload = reinterpret_cast<const uint8_t *>(&packet);
+    }
+
+    uint16_t frame_crc16 =
+        FrameCRC::calc(frame.header.data(), Protocol::header_size);
+    frame_crc16 = FrameCRC::calc(frame.segments()[1].data(), data_size,
+                                 frame_crc16);
+    write_tail(frame.tail.data(), frame_crc16);
+
+    m_Sequence += 1;
+    return frame;
+  }
+
   /**
    * @brief 计算指定类型的完整帧大小
    *
@@ -266,6 +311,140 @@ public:
   }
 
 private:
+  /**
+   * @brief 协议帧头中是否包含序列号字段
+   * @tparam Protocol 协议类型
+   */
+  template <typename Protocol>
+  static constexpr bool has_seq_field = [] {
+    if constexpr (requires { Protocol::has_seq_field; })
+      return Protocol::has_seq_field;
+    else
+      return false;
+  }();
+
+  /**
+   * @brief 填充完整帧头（起始字节、长度、序列号、帧头 CRC、命令码）
+   *
+   * @tparam T 数据包类型
+   * @param header 至少 Protocol::header_size 字节的输出缓冲区
+   * @param sequence 序列号
+   */
+  template <typename T>
+  static constexpr void fill_header(uint8_t *header,
+                                    uint8_t sequence) noexcept {
+    using Protocol = typename Meta::PacketTraits<T>::Protocol;
+    constexpr uint16_t cmd = Meta::PacketTraits<T>::cmd;
+    constexpr size_t data_size = Meta::PacketTraits<T>::size;
+
+    // 帧头 (起始字节)
+    header[0] = Protocol::start_byte;
+    if constexpr (Protocol::has_second_byte) {
+      header[1] = Protocol::second_byte;
+    }
+
+    // 长度字段
+    if constexpr (Protocol::has_length_field) {
+      const auto data_size_u16 = static_cast<uint16_t>(data_size);
+      // 长度字段采用小端格式
+      if constexpr (Protocol::length_field_bytes == 1) {
+        header[Protocol::length_offset] =
+            static_cast<uint8_t>(data_size_u16 & 0xFF);
+      } else {
+        header[Protocol::length_offset] =
+            static_cast<uint8_t>(data_size_u16 & 0xFF);
+        header[Protocol::length_offset + 1] =
+            static_cast<uint8_t>((data_size_u16 >> 8) & 0xFF);
+      }
+    }
+
+    // Sequence 字段
+    if constexpr (has_seq_field<Protocol>) {
+      header[Protocol::seq_offset] = sequence;
+    }
+
+    // 帧头 CRC
+    if constexpr (Protocol::has_header_crc) {
+      // CRC8 覆盖从 0 到 header_crc_offset 的字节
+      header[Protocol::header_crc_offset] =
+          Meta::HeaderCRC_t<Protocol>::calc(header, Protocol::header_crc_offset);
+    }
+
+    // 命令 ID 字段
+    if constexpr (Protocol::has_cmd_field) {
+      // 命令字段采用小端格式
+      if constexpr (Protocol::cmd_field_bytes == 1) {
+        header[Protocol::cmd_offset] = static_cast<uint8_t>(cmd & 0xFF);
+      } else {
+        header[Protocol::cmd_offset] = static_cast<uint8_t>(cmd & 0xFF);
+        header[Protocol::cmd_offset + 1] =
+            static_cast<uint8_t>((cmd >> 8) & 0xFF);
+      }
+    }
+  }
+
+  /**
+   * @brief 编译期预计算的帧头模板
+   *
+   * 定长数据包的帧头中只有序列号（以及覆盖它的帧头 CRC）随调用变化。
+   * bytes 为序列号取 0 时的完整帧头；crc_prefix 为帧头 CRC 在序列号
+   * 之前各字节上的中间值，运行时只需从序列号处继续计算剩余的 1~2 字节。
+   */
+  template <size_t HeaderSize> struct HeaderTemplate {
+    std::array<uint8_t, HeaderSize> bytes{};
+    uint8_t crc_prefix{};
+  };
+
+  template <typename T> static constexpr auto make_header_template() {
+    using Protocol = typename Meta::PacketTraits<T>::Protocol;
+    HeaderTemplate<Protocol::header_size> tmpl{};
+    fill_header<T>(tmpl.bytes.data(), 0);
+    if constexpr (has_seq_field<Protocol> && Protocol::has_header_crc) {
+      if constexpr (Protocol::seq_offset < Protocol::header_crc_offset) {
+        tmpl.crc_prefix = static_cast<uint8_t>(
+            Meta::HeaderCRC_t<Protocol>::calc(tmpl.bytes.data(),
+                                              Protocol::seq_offset));
+      }
+    }
+    return tmpl;
+  }
+
+  /// @brief 每个数据包类型的帧头模板
+  template <typename T>
+  static constexpr auto header_template = make_header_template<T>();
+
+  /**
+   * @brief 写入帧头
+   *
+   * 拷贝编译期帧头模板，再写入序列号并从 crc_prefix 继续计算帧头 CRC。
+   *
+   * @tparam T 数据包类型
+   * @param header 至少 Protocol::header_size 字节的输出缓冲区
+   */
+  template <typename T> void write_header(uint8_t *header) const noexcept {
+    using Protocol = typename Meta::PacketTraits<T>::Protocol;
+    constexpr auto &tmpl = header_template<T>;
+    std::memcpy(header, tmpl.bytes.data(), Protocol::header_size);
+
+    if constexpr (has_seq_field<Protocol>) {
+      header[Protocol::seq_offset] = m_Sequence;
+      if constexpr (Protocol::has_header_crc &&
+                    Protocol::seq_offset < Protocol::header_crc_offset) {
+        header[Protocol::header_crc_offset] =
+            static_cast<uint8_t>(Meta::HeaderCRC_t<Protocol>::calc(
+                header + Protocol::seq_offset,
+                Protocol::header_crc_offset - Protocol::seq_offset,
+                tmpl.crc_prefix));
+      }
+    }
+  }
+
+  /// @brief 写入帧尾 CRC16（小端格式）
+  static void write_tail(uint8_t *tail, uint16_t frame_crc16) noexcept {
+    tail[0] = static_cast<uint8_t>(frame_crc16 & 0xFF);
+    tail[1] = static_cast<uint8_t>((frame_crc16 >> 8) & 0xFF);
+  }
+
   // 编译期命令码到类型映射的辅助函数
   template <uint16_t cmd, typename T, typename... Rest>
   static constexpr auto create_packet_by_cmd_impl() {
@@ -0,0 +1,258 @@
+/**
+ * @file ClmulCRC.hpp
+ * @brief RPL 无进位乘法 (PCLMULQDQ / PMULL) 折叠 CRC 实现
+ *
+ * 此文件提供基于无进位乘法的折叠 (folding) CRC 计算引擎，
+ * 面向 x86-64 与 AArch64 上转发裁判系统数据的主机。
+ *
+ * @par 设计原理
+ * - 输入按 16 字节分块装入 128 位寄存器，低 64 位通道对应高次项
+ * - 每次折叠把累加值乘以 x^(8D) mod P 的常量后与 D 字节之后的数据块异或，
+ *   使累加值始终与已处理的消息模 P 同余；大数据使用 4 路并行累加器
+ * - 折叠结束后剩下的 16 字节与不足 16 字节的尾部交给 Fallback 查表计算，
+ *   因此无需 Barrett 约减，同一份代码适用于任意宽度不超过 32 位的反射型 CRC
+ * - 折叠常量在编译期由 Base::poly 计算
+ *
+ * @par 运行时分发
+ * - x86-64 (GCC/Clang): 通过 __builtin_cpu_supports("pclmul") 检测，
+ *   折叠函数使用 target 属性编译，无需额外的编译选项
+ * - AArch64: 需要以 +crypto (或 +aes) 编译；Linux 下额外通过 HWCAP_PMULL 检测
+ * - 其他平台、CPU 不支持或数据较短时，自动回退到 Fallback
+ *
+ * @note 此实现依赖运行时检测与 SIMD 指令，不是 constexpr，也不适用于 MCU
+ */
+
+#ifndef RPL_CLMUL_CRC_HPP
+#define RPL_CLMUL_CRC_HPP
+
+#include <cppcrc.h>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define RPL_CLMUL_CRC_X86 1
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#elif defined(__aarch64__) &&                                                  \
+    (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define RPL_CLMUL_CRC_ARM 1
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace RPL {
+
+namespace Detail {
+/**
+ * @brief 检测当前 CPU 是否支持 64 位无进位乘法
+ * @return true 如果支持 PCLMULQDQ (x86-64) 或 PMULL (AArch64)
+ */
+inline bool cpu_has_clmul() noexcept {
+#if defined(RPL_CLMUL_CRC_X86)
+  static const bool supported = __builtin_cpu_supports("pclmul");
+  return supported;
+#elif defined(RPL_CLMUL_CRC_ARM) && defined(__linux__)
+  static const bool supported = (getauxval(AT_HWCAP) & HWCAP_PMULL) != 0;
+  return supported;
+#elif defined(RPL_CLMUL_CRC_ARM)
+  return true;
+#else
+  return false;
+#endif
+}
+} // namespace Detail
+
+/**
+ * @brief 无进位乘法折叠 CRC 计算器
+ *
+ * 与 crc_utils::crc 提供相同的静态接口，可直接作为 Protocol::RPL_CRC 使用，
+ * 并支持分段续算。定义 RPL_USE_CLMUL_CRC 后 DefaultProtocol 默认使用它。
+ *
+ * @tparam Base cppcrc.h 中的 CRC 配置，必须为输入/输出反射型
+ * @tparam Fallback 短数据、尾部以及不支持的平台上使用的实现，默认即 Base
+ *
+ * @par 使用示例
+ * @code
+ * struct BridgeProtocol : RPL::Meta::DefaultProtocol {
+ *     using RPL_CRC = RPL::ProtocolCRC16Clmul;
+ * };
+ * @endcode
+ */
+template <typename Base, typename Fallback = Base> struct ClmulCRC {
+  static_assert(Base::refl_in && Base::refl_out,
+                "ClmulCRC only supports reflected CRC configurations");
+  static_assert(sizeof(typename Base::type) <= 4,
+                "ClmulCRC supports CRC widths up to 32 bits");
+
+  using type = typename Base::type;                ///< CRC 结果类型
+  static constexpr type poly = Base::poly;         ///< 生成多项式
+  static constexpr type init = Base::init;         ///< 初始值
+  static constexpr bool refl_in = Base::refl_in;   ///< 输入反射
+  static constexpr bool refl_out = Base::refl_out; ///< 输出反射
+  static constexpr type x_or_out = Base::x_or_out; ///< 输出异或值
+  static constexpr type null_crc = Base::null_crc; ///< 空数据的 CRC 值
+
+  /// @brief 启用折叠路径的最小数据长度，更短的数据直接使用 Fallback
+  static constexpr size_t min_fold_size = 64;
+
+  /**
+   * @brief 计算 CRC，或传入上一段的结果继续计算
+   *
+   * @param bytes 数据指针
+   * @param num_bytes 数据长度
+   * @param prior_crc_value 上一段的 CRC 结果（首段使用默认值）
+   * @return CRC 结果，与 Base::calc 完全一致
+   */
+  static type calc(const uint8_t *bytes = nullptr, size_t num_bytes = 0u,
+                   type prior_crc_value = null_crc) {
+#if defined(RPL_CLMUL_CRC_X86) || defined(RPL_CLMUL_CRC_ARM)
+    if (num_bytes >= min_fold_size && Detail::cpu_has_clmul()) {
+      const uint32_t state = static_cast<type>(prior_crc_value ^ x_or_out);
+      uint8_t folded[16];
+      const size_t consumed = fold(bytes, num_bytes, state, folded);
+      // 折叠结果与已处理数据同余，从零状态 (prior = x_or_out) 对其查表即可
+      const type crc = Fallback::calc(folded, sizeof(folded), x_or_out);
+      return Fallback::calc(bytes + consumed, num_bytes - consumed, crc);
+    }
+#endif
+    return Fallback::calc(bytes, num_bytes, prior_crc_value);
+  }
+
+  /// @brief 单字节查找表（与 Base::table() 相同）
+  static constexpr auto &table() { return Base::table(); }
+
+private:
+  static constexpr size_t width = sizeof(type) * 8;
+
+  /// @brief 计算 x^e mod P 并按寄存器通道位序反射到 64 位
+  static constexpr uint64_t xpow_mod(size_t e) {
+    const uint64_t top = uint64_t{1} << width;
+    uint64_t r = 1;
+    for (size_t i = 0; i < e; ++i) {
+      r <<= 1;
+      if (r & top)
+        r ^= top | poly;
+    }
+    return crc_utils::reverse_bits(r);
+  }
+
+  /**
+   * @brief 向后折叠 Distance 字节所需的常量
+   *
+   * 低通道对应 x^(8D+63)，高通道对应 x^(8D-1)；
+   * 指数减一用于抵消反射域中无进位乘法结果整体偏移一位。
+   */
+  template <size_t Distance> struct FoldConst {
+    static constexpr uint64_t lo = xpow_mod(8 * Distance + 63);
+    static constexpr uint64_t hi = xpow_mod(8 * Distance - 1);
+  };
+
+#if defined(RPL_CLMUL_CRC_X86)
+  __attribute__((target("pclmul,sse2"))) static inline __m128i
+  fold_block(__m128i x, __m128i k) {
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00),
+                         _mm_clmulepi64_si128(x, k, 0x11));
+  }
+
+  /**
+   * @brief 将 16 字节对齐部分折叠为一个 128 位余数
+   * @return 已折叠的字节数（16 的倍数，且不小于 64）
+   */
+  __attribute__((target("pclmul,sse2"))) static size_t
+  fold(const uint8_t *p, size_t n, uint32_t state, uint8_t *out) {
+    const __m128i k64 = _mm_set_epi64x(static_cast<long long>(FoldConst<64>::hi),
+                                       static_cast<long long>(FoldConst<64>::lo));
+    const __m128i k16 = _mm_set_epi64x(static_cast<long long>(FoldConst<16>::hi),
+                                       static_cast<long long>(FoldConst<16>::lo));
+    auto load = [](const uint8_t *src) {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    };
+
+    const uint8_t *const begin = p;
+    __m128i x0 = _mm_xor_si128(load(p), _mm_cvtsi32_si128(static_cast<int>(state)));
+    __m128i x1 = load(p + 16);
+    __m128i x2 = load(p + 32);
+    __m128i x3 = load(p + 48);
+    p += 64;
+    n -= 64;
+
+    while (n >= 64) {
+      x0 = _mm_xor_si128(fold_block(x0, k64), load(p));
+      x1 = _mm_xor_si128(fold_block(x1, k64), load(p + 16));
+      x2 = _mm_xor_si128(fold_block(x2, k64), load(p + 32));
+      x3 = _mm_xor_si128(fold_block(x3, k64), load(p + 48));
+      p += 64;
+      n -= 64;
+    }
+
+    __m128i x = _mm_xor_si128(fold_block(x0, k16), x1);
+    x = _mm_xor_si128(fold_block(x, k16), x2);
+    x = _mm_xor_si128(fold_block(x, k16), x3);
+
+    while (n >= 16) {
+      x = _mm_xor_si128(fold_block(x, k16), load(p));
+      p += 16;
+      n -= 16;
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out), x);
+    return static_cast<size_t>(p - begin);
+  }
+#elif defined(RPL_CLMUL_CRC_ARM)
+  static inline uint64x2_t fold_block(uint64x2_t x, uint64_t k_lo,
+                                      uint64_t k_hi) {
+    const poly128_t lo = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(x, 0)),
+                                   static_cast<poly64_t>(k_lo));
+    const poly128_t hi = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(x, 1)),
+                                   static_cast<poly64_t>(k_hi));
+    return veorq_u64(vreinterpretq_u64_p128(lo), vreinterpretq_u64_p128(hi));
+  }
+
+  static size_t fold(const uint8_t *p, size_t n, uint32_t state,
+                     uint8_t *out) {
+    constexpr uint64_t k64_lo = FoldConst<64>::lo, k64_hi = FoldConst<64>::hi;
+    constexpr uint64_t k16_lo = FoldConst<16>::lo, k16_hi = FoldConst<16>::hi;
+    auto load = [](const uint8_t *src) {
+      return vreinterpretq_u64_u8(vld1q_u8(src));
+    };
+
+    const uint8_t *const begin = p;
+    uint64x2_t x0 = veorq_u64(load(p), vcombine_u64(vcreate_u64(state),
+                                                    vcreate_u64(0)));
+    uint64x2_t x1 = load(p + 16);
+    uint64x2_t x2 = load(p + 32);
+    uint64x2_t x3 = load(p + 48);
+    p += 64;
+    n -= 64;
+
+    while (n >= 64) {
+      x0 = veorq_u64(fold_block(x0, k64_lo, k64_hi), load(p));
+      x1 = veorq_u64(fold_block(x1, k64_lo, k64_hi), load(p + 16));
+      x2 = veorq_u64(fold_block(x2, k64_lo, k64_hi), load(p + 32));
+      x3 = veorq_u64(fold_block(x3, k64_lo, k64_hi), load(p + 48));
+      p += 64;
+      n -= 64;
+    }
+
+    uint64x2_t x = veorq_u64(fold_block(x0, k16_lo, k16_hi), x1);
+    x = veorq_u64(fold_block(x, k16_lo, k16_hi), x2);
+    x = veorq_u64(fold_block(x, k16_lo, k16_hi), x3);
+
+    while (n >= 16) {
+      x = veorq_u64(fold_block(x, k16_lo, k16_hi), load(p));
+      p += 16;
+      n -= 16;
+    }
+
+    vst1q_u8(out, vreinterpretq_u8_u64(x));
+    return static_cast<size_t>(p - begin);
+  }
+#endif
+};
+
+} // namespace RPL
+
+#endif // RPL_CLMUL_CRC_HPP
@@ -9,7 +9,10 @@
 
 #ifndef RPL_DEF_HPP
 #define RPL_DEF_HPP
+#include "RPL/Utils/ClmulCRC.hpp"
+#include "RPL/Utils/SlicingCRC.hpp"
 #include <cppcrc.h>
+#include <cstddef>
 #include <cstdint>
 
 namespace RPL {
@@ -23,6 +26,30 @@ using ProtocolCRC8 = crc_utils::crc<uint8_t, 0x31, 0xFF, true, true, 0x00>;
 /// 与裁判系统协议一致
 using ProtocolCRC16 = CRC16::MCRF4XX;
 
+/// 多表 CRC 变体，结果与上面的逐字节实现一致，可用作 Protocol::RPL_CRC /
+/// Protocol::RPL_HEADER_CRC，以查找表体积换取吞吐
+using ProtocolCRC8Slicing4 = SlicingCRC<ProtocolCRC8, 4>;
+using ProtocolCRC16Slicing8 = SlicingCRC<ProtocolCRC16, 8>;
+using ProtocolCRC16Slicing16 = SlicingCRC<ProtocolCRC16, 16>;
+
+/// 无进位乘法折叠 CRC16，运行时检测 PCLMULQDQ/PMULL，不支持时回退到
+/// Slicing-by-8；定义 RPL_USE_CLMUL_CRC 后作为 DefaultProtocol 的默认 CRC
+using ProtocolCRC16Clmul = ClmulCRC<ProtocolCRC16, ProtocolCRC16Slicing8>;
+
+#ifndef RPL_CACHE_LINE_SIZE
+#define RPL_CACHE_LINE_SIZE 64 ///< 缓存行大小（字节），可在编译选项中覆盖
+#endif
+
+/// Deserializer 槽位对齐：定义 RPL_CACHE_LINE_ISOLATION 时，每个数据包的
+/// SeqLock version 与数据各自独占缓存行，避免多核读者之间的伪共享
+#ifdef RPL_CACHE_LINE_ISOLATION
+static constexpr size_t SLOT_ALIGNMENT = RPL_CACHE_LINE_SIZE;
+#else
+static constexpr size_t SLOT_ALIGNMENT = 1;
+#endif
+static_assert((SLOT_ALIGNMENT & (SLOT_ALIGNMENT - 1)) == 0,
+              "RPL_CACHE_LINE_SIZE must be a power of 2");
+
 } // namespace RPL
 
 #endif // RPL_DEF_HPP
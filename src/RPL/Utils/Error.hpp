@@ -10,8 +10,7 @@
 #ifndef RPL_ERROR_HPP
 #define RPL_ERROR_HPP
 
-#include <string>
-#include <utility>
+#include <type_traits>
 
 namespace RPL
 {
@@ -32,10 +31,36 @@ namespace RPL
         InvalidCommand,   ///< 无效命令
     };
 
+    /**
+     * @brief 获取错误码的默认描述
+     *
+     * 返回指向静态字符串的指针，不涉及任何内存分配。
+     *
+     * @param c 错误码
+     * @return 错误码对应的静态描述字符串
+     */
+    constexpr const char* to_string(const ErrorCode c) noexcept
+    {
+        switch (c)
+        {
+        case ErrorCode::Again: return "Again";
+        case ErrorCode::InsufficientData: return "Insufficient data";
+        case ErrorCode::NoFrameHeader: return "No frame header";
+        case ErrorCode::InvalidFrameHeader: return "Invalid frame header";
+        case ErrorCode::CrcMismatch: return "CRC mismatch";
+        case ErrorCode::BufferOverflow: return "Buffer overflow";
+        case ErrorCode::InternalError: return "Internal error";
+        case ErrorCode::InvalidCommand: return "Invalid command";
+        }
+        return "Unknown error";
+    }
+
     /**
      * @brief 错误结构体
      *
-     * 包含错误码和错误消息的结构体
+     * 包含错误码和错误消息的结构体。
+     * 消息只保存指向静态字符串的指针，Error 可平凡拷贝，
+     * 构造与返回均不分配内存，可在中断上下文中使用。
      */
     struct Error
     {
@@ -45,15 +70,28 @@ namespace RPL
          * 使用错误码和错误消息构造错误对象
          *
          * @param c 错误码
-         * @param msg 错误消息
+         * @param msg 错误消息，必须具有静态存储期（如字符串字面量）
+         */
+        constexpr Error(const ErrorCode c, const char* msg) noexcept : message(msg), code(c)
+        {
+        }
+
+        /**
+         * @brief 构造函数
+         *
+         * 使用错误码构造错误对象，消息取 to_string(c)
+         *
+         * @param c 错误码
          */
-        Error(const ErrorCode c, std::string msg) : message(std::move(msg)), code(c)
+        constexpr explicit Error(const ErrorCode c) noexcept : message(to_string(c)), code(c)
         {
         }
 
-        std::string message;  ///< 错误消息
+        const char* message;  ///< 错误消息（静态字符串）
         ErrorCode code;       ///< 错误码
     };
+
+    static_assert(std::is_trivially_copyable_v<Error>, "Error must stay trivially copyable");
 }
 
 #endif //RPL_ERROR_HPP
@@ -0,0 +1,159 @@
+/**
+ * @file SlicingCRC.hpp
+ * @brief RPL 多表 (Slicing-by-N) CRC 实现
+ *
+ * 此文件提供基于多张查找表的 CRC 计算引擎，每次迭代处理 N 个字节，
+ * 用于替换 cppcrc.h 中逐字节查表的实现。
+ *
+ * @par 设计原理
+ * - 第 0 张表直接复用 cppcrc.h 编译期生成的 crc_lookup_table
+ * - 第 k 张表表示"字节 b 之后再跟随 k 个零字节"对 CRC 的贡献，
+ *   同样在编译期由第 k-1 张表递推生成
+ * - 每次迭代以小端序读入 N 个字节，与当前 CRC 异或后分别查表再异或合并，
+ *   消除逐字节实现中的串行依赖链
+ * - 不足 N 字节的尾部回退到逐字节查表
+ *
+ * @par 使用场景
+ * - Linux 网关等对大帧 (如 RobotInteractionData、8KB 帧) 吞吐敏感的平台
+ * - 通过 Protocol 的 RPL_CRC / RPL_HEADER_CRC 选择，Parser 与 Serializer 无需修改
+ *
+ * @note 每张表 256 项，Slicing-by-8 的 CRC16 需要 8KB 查找表，
+ *       Flash 紧张的 MCU 平台应继续使用默认的逐字节实现
+ */
+
+#ifndef RPL_SLICING_CRC_HPP
+#define RPL_SLICING_CRC_HPP
+
+#include <array>
+#include <cppcrc.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace RPL {
+
+/**
+ * @brief Slicing-by-N CRC 计算器
+ *
+ * 与 crc_utils::crc 提供相同的静态接口 (type / null_crc / calc / table)，
+ * 因此可直接作为 Protocol::RPL_CRC 使用，并支持分段续算。
+ *
+ * @tparam Base cppcrc.h 中的 CRC 配置 (如 CRC16::MCRF4XX)，必须为输入/输出反射型
+ * @tparam Slices 每次迭代处理的字节数，支持 4、8、16
+ *
+ * @par 使用示例
+ * @code
+ * struct FastProtocol : RPL::Meta::DefaultProtocol {
+ *     using RPL_CRC = RPL::ProtocolCRC16Slicing8;
+ *     using RPL_HEADER_CRC = RPL::ProtocolCRC8Slicing4;
+ * };
+ *
+ * template <>
+ * struct RPL::Meta::PacketTraits<MyPacket> : PacketTraitsBase<PacketTraits<MyPacket>> {
+ *     static constexpr uint16_t cmd = 0x0301;
+ *     static constexpr size_t size = sizeof(MyPacket);
+ *     using Protocol = FastProtocol;
+ * };
+ * @endcode
+ *
+ * @warning 同一 Parser 中起始字节相同的数据包必须使用同一个 Protocol 类型，
+ *          否则会触发 RPL_ERROR_START_BYTE_COLLISION
+ */
+template <typename Base, size_t Slices = 8> struct SlicingCRC {
+  static_assert(Base::refl_in && Base::refl_out,
+                "SlicingCRC only supports reflected CRC configurations");
+  static_assert(Slices == 4 || Slices == 8 || Slices == 16,
+                "Slices must be 4, 8 or 16");
+  static_assert(sizeof(typename Base::type) <= 4,
+                "SlicingCRC supports CRC widths up to 32 bits");
+
+  using type = typename Base::type;                        ///< CRC 结果类型
+  static constexpr type poly = Base::poly;                 ///< 生成多项式
+  static constexpr type init = Base::init;                 ///< 初始值
+  static constexpr bool refl_in = Base::refl_in;           ///< 输入反射
+  static constexpr bool refl_out = Base::refl_out;         ///< 输出反射
+  static constexpr type x_or_out = Base::x_or_out;         ///< 输出异或值
+  static constexpr type null_crc = Base::null_crc;         ///< 空数据的 CRC 值
+  static constexpr size_t slices = Slices;                 ///< 每次迭代处理的字节数
+
+  /**
+   * @brief 编译期生成的 Slicing 查找表
+   *
+   * tables[0] 即 cppcrc.h 的原始查找表，
+   * tables[k][b] = (tables[k-1][b] >> 8) ^ tables[0][tables[k-1][b] & 0xFF]。
+   */
+  static constexpr auto tables = []() {
+    std::array<std::array<type, 256>, Slices> t{};
+    for (size_t i = 0; i < 256; ++i)
+      t[0][i] = Base::table()[i];
+    for (size_t k = 1; k < Slices; ++k) {
+      for (size_t i = 0; i < 256; ++i) {
+        const type prev = t[k - 1][i];
+        t[k][i] = static_cast<type>((prev >> 8) ^
+                                    t[0][static_cast<uint8_t>(prev)]);
+      }
+    }
+    return t;
+  }();
+
+  /**
+   * @brief 计算 CRC，或传入上一段的结果继续计算
+   *
+   * @param bytes 数据指针
+   * @param num_bytes 数据长度
+   * @param prior_crc_value 上一段的 CRC 结果（首段使用默认值）
+   * @return CRC 结果，与 Base::calc 完全一致
+   */
+  static constexpr type calc(const uint8_t *bytes = nullptr,
+                             size_t num_bytes = 0u,
+                             type prior_crc_value = null_crc) {
+    uint32_t crc = static_cast<type>(prior_crc_value ^ x_or_out);
+
+    while (num_bytes >= Slices) {
+      if constexpr (Slices == 4) {
+        const uint32_t w = load_le32(bytes) ^ crc;
+        crc = fold32<0>(w);
+      } else if constexpr (Slices == 8) {
+        const uint32_t lo = load_le32(bytes) ^ crc;
+        const uint32_t hi = load_le32(bytes + 4);
+        crc = fold32<4>(lo) ^ fold32<0>(hi);
+      } else {
+        const uint32_t w0 = load_le32(bytes) ^ crc;
+        const uint32_t w1 = load_le32(bytes + 4);
+        const uint32_t w2 = load_le32(bytes + 8);
+        const uint32_t w3 = load_le32(bytes + 12);
+        crc = fold32<12>(w0) ^ fold32<8>(w1) ^ fold32<4>(w2) ^ fold32<0>(w3);
+      }
+      bytes += Slices;
+      num_bytes -= Slices;
+    }
+
+    while (num_bytes--) {
+      crc = tables[0][static_cast<uint8_t>(*bytes++ ^ crc)] ^ (crc >> 8);
+    }
+    return static_cast<type>(crc ^ x_or_out);
+  }
+
+  /// @brief 单字节查找表（与 Base::table() 相同）
+  static constexpr auto &table() { return tables[0]; }
+
+private:
+  /// @brief 以小端序读取 4 字节（编译器会合并为单次加载）
+  static constexpr uint32_t load_le32(const uint8_t *p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) |
+           (static_cast<uint32_t>(p[3]) << 24);
+  }
+
+  /**
+   * @brief 将 4 字节字折叠进 CRC
+   * @tparam Shift 该字之后还剩余的字节数（决定使用哪一组表）
+   */
+  template <size_t Shift> static constexpr uint32_t fold32(uint32_t w) {
+    return tables[Shift + 3][w & 0xFF] ^ tables[Shift + 2][(w >> 8) & 0xFF] ^
+           tables[Shift + 1][(w >> 16) & 0xFF] ^ tables[Shift][w >> 24];
+  }
+};
+
+} // namespace RPL
+
+#endif // RPL_SLICING_CRC_HPP
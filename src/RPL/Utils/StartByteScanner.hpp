@@ -0,0 +1,106 @@
+/**
+ * @file StartByteScanner.hpp
+ * @brief RPL 多起始字节 SIMD 扫描器
+ *
+ * Parser 注册了多个协议（例如 DefaultProtocol 的 0xA5 与
+ * VT03RemoteProtocol 的 0xA9）时无法使用 memchr，此文件提供按编译期
+ * 起始字节集合生成的向量化扫描，每次比较 16 字节。
+ *
+ * @par 设计原理
+ * - 起始字节集合由 Parser 的 header_lut 在编译期导出，作为模板参数传入
+ * - 每个 16 字节块与集合中每个起始字节逐一比较后按位或，
+ *   得到命中掩码后用 countr_zero 取第一个命中位置
+ * - 不足 16 字节的尾部以及不支持 SIMD 的平台回退到逐字节查表
+ *
+ * @par 平台
+ * - x86-64: SSE2（基线指令集，无需编译选项与运行时检测）
+ * - AArch64 / ARMv7 (__ARM_NEON): NEON
+ * - 其他平台（包括 Cortex-M MCU）: 逐字节查表
+ */
+
+#ifndef RPL_START_BYTE_SCANNER_HPP
+#define RPL_START_BYTE_SCANNER_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define RPL_START_BYTE_SCANNER_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define RPL_START_BYTE_SCANNER_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace RPL::Detail {
+
+/**
+ * @brief 从 256 项查找表中导出起始字节集合
+ *
+ * @tparam N 集合大小（查找表中有效项的数量）
+ * @param lut 起始字节 → Worker 索引的查找表，0xFF 表示未注册
+ */
+template <size_t N>
+constexpr std::array<uint8_t, N>
+start_bytes_from_lut(const std::array<uint8_t, 256> &lut) {
+  std::array<uint8_t, N> bytes{};
+  size_t count = 0;
+  for (size_t i = 0; i < 256 && count < N; ++i) {
+    if (lut[i] != 0xFF)
+      bytes[count++] = static_cast<uint8_t>(i);
+  }
+  return bytes;
+}
+
+/**
+ * @brief 查找第一个属于起始字节集合的字节
+ *
+ * @tparam StartBytes 编译期起始字节集合
+ * @param data 数据指针
+ * @param size 数据长度
+ * @param lut 与 StartBytes 一致的 256 项查找表（用于标量尾部）
+ * @return 第一个命中的下标，找不到时返回 size
+ */
+template <auto StartBytes>
+inline size_t find_first_start_byte(const uint8_t *data, size_t size,
+                                    const std::array<uint8_t, 256> &lut) noexcept {
+  size_t i = 0;
+
+#if defined(RPL_START_BYTE_SCANNER_SSE2)
+  __m128i needles[StartBytes.size()];
+  for (size_t k = 0; k < StartBytes.size(); ++k)
+    needles[k] = _mm_set1_epi8(static_cast<char>(StartBytes[k]));
+  for (; i + 16 <= size; i += 16) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    __m128i hits = _mm_setzero_si128();
+    for (const auto &needle : needles)
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, needle));
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(hits));
+    if (mask != 0)
+      return i + static_cast<size_t>(std::countr_zero(mask));
+  }
+#elif defined(RPL_START_BYTE_SCANNER_NEON)
+  for (; i + 16 <= size; i += 16) {
+    const uint8x16_t block = vld1q_u8(data + i);
+    uint8x16_t hits = vdupq_n_u8(0);
+    for (const uint8_t sb : StartBytes)
+      hits = vorrq_u8(hits, vceqq_u8(block, vdupq_n_u8(sb)));
+    // 每字节压缩为 4 位，得到 64 位掩码
+    const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(hits), 4);
+    const uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    if (mask != 0)
+      return i + static_cast<size_t>(std::countr_zero(mask) >> 2);
+  }
+#endif
+
+  while (i < size && lut[data[i]] == 0xFF)
+    ++i;
+  return i;
+}
+
+} // namespace RPL::Detail
+
+#endif // RPL_START_BYTE_SCANNER_HPP